@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Alphabet.cpp" "CMakeFiles/AllocationTest.dir/src/Alphabet.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/Alphabet.cpp.o.d"
+  "/root/repo/src/ConfigurationStream.cpp" "CMakeFiles/AllocationTest.dir/src/ConfigurationStream.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/ConfigurationStream.cpp.o.d"
+  "/root/repo/src/DFAScanner.cpp" "CMakeFiles/AllocationTest.dir/src/DFAScanner.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/DFAScanner.cpp.o.d"
+  "/root/repo/src/DivergenceDetector.cpp" "CMakeFiles/AllocationTest.dir/src/DivergenceDetector.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/DivergenceDetector.cpp.o.d"
+  "/root/repo/src/ExecutionContext.cpp" "CMakeFiles/AllocationTest.dir/src/ExecutionContext.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/ExecutionContext.cpp.o.d"
+  "/root/repo/src/ExecutionProfiler.cpp" "CMakeFiles/AllocationTest.dir/src/ExecutionProfiler.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/ExecutionProfiler.cpp.o.d"
+  "/root/repo/src/InputSource.cpp" "CMakeFiles/AllocationTest.dir/src/InputSource.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/InputSource.cpp.o.d"
+  "/root/repo/src/LockstepEngine.cpp" "CMakeFiles/AllocationTest.dir/src/LockstepEngine.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/LockstepEngine.cpp.o.d"
+  "/root/repo/src/MTParser.cpp" "CMakeFiles/AllocationTest.dir/src/MTParser.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/MTParser.cpp.o.d"
+  "/root/repo/src/MTSimulator.cpp" "CMakeFiles/AllocationTest.dir/src/MTSimulator.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/MTSimulator.cpp.o.d"
+  "/root/repo/src/MachineEnumerator.cpp" "CMakeFiles/AllocationTest.dir/src/MachineEnumerator.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/MachineEnumerator.cpp.o.d"
+  "/root/repo/src/MachineProgram.cpp" "CMakeFiles/AllocationTest.dir/src/MachineProgram.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/MachineProgram.cpp.o.d"
+  "/root/repo/src/PageArena.cpp" "CMakeFiles/AllocationTest.dir/src/PageArena.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/PageArena.cpp.o.d"
+  "/root/repo/src/PersistentRun.cpp" "CMakeFiles/AllocationTest.dir/src/PersistentRun.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/PersistentRun.cpp.o.d"
+  "/root/repo/src/PersistentTape.cpp" "CMakeFiles/AllocationTest.dir/src/PersistentTape.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/PersistentTape.cpp.o.d"
+  "/root/repo/src/ProgressMonitor.cpp" "CMakeFiles/AllocationTest.dir/src/ProgressMonitor.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/ProgressMonitor.cpp.o.d"
+  "/root/repo/src/ResourceGovernor.cpp" "CMakeFiles/AllocationTest.dir/src/ResourceGovernor.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/ResourceGovernor.cpp.o.d"
+  "/root/repo/src/RunScheduler.cpp" "CMakeFiles/AllocationTest.dir/src/RunScheduler.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/RunScheduler.cpp.o.d"
+  "/root/repo/src/RunStats.cpp" "CMakeFiles/AllocationTest.dir/src/RunStats.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/RunStats.cpp.o.d"
+  "/root/repo/src/SimdKernels.cpp" "CMakeFiles/AllocationTest.dir/src/SimdKernels.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/SimdKernels.cpp.o.d"
+  "/root/repo/src/State.cpp" "CMakeFiles/AllocationTest.dir/src/State.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/State.cpp.o.d"
+  "/root/repo/src/SymbolPattern.cpp" "CMakeFiles/AllocationTest.dir/src/SymbolPattern.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/SymbolPattern.cpp.o.d"
+  "/root/repo/src/Tape.cpp" "CMakeFiles/AllocationTest.dir/src/Tape.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/Tape.cpp.o.d"
+  "/root/repo/src/TapeBank.cpp" "CMakeFiles/AllocationTest.dir/src/TapeBank.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/TapeBank.cpp.o.d"
+  "/root/repo/src/TapePrimitives.cpp" "CMakeFiles/AllocationTest.dir/src/TapePrimitives.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/TapePrimitives.cpp.o.d"
+  "/root/repo/src/TapeSpill.cpp" "CMakeFiles/AllocationTest.dir/src/TapeSpill.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/TapeSpill.cpp.o.d"
+  "/root/repo/src/TraceWriter.cpp" "CMakeFiles/AllocationTest.dir/src/TraceWriter.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/TraceWriter.cpp.o.d"
+  "/root/repo/src/Transition.cpp" "CMakeFiles/AllocationTest.dir/src/Transition.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/Transition.cpp.o.d"
+  "/root/repo/src/TransitionTable.cpp" "CMakeFiles/AllocationTest.dir/src/TransitionTable.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/TransitionTable.cpp.o.d"
+  "/root/repo/src/TuringMachine.cpp" "CMakeFiles/AllocationTest.dir/src/TuringMachine.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/TuringMachine.cpp.o.d"
+  "/root/repo/src/WorkerPool.cpp" "CMakeFiles/AllocationTest.dir/src/WorkerPool.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/src/WorkerPool.cpp.o.d"
+  "/root/repo/tests/AllocationTest.cpp" "CMakeFiles/AllocationTest.dir/tests/AllocationTest.cpp.o" "gcc" "CMakeFiles/AllocationTest.dir/tests/AllocationTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
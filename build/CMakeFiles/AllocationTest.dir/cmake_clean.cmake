@@ -0,0 +1,73 @@
+file(REMOVE_RECURSE
+  "AllocationTest"
+  "AllocationTest.pdb"
+  "CMakeFiles/AllocationTest.dir/src/Alphabet.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/Alphabet.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/ConfigurationStream.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/ConfigurationStream.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/DFAScanner.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/DFAScanner.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/DivergenceDetector.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/DivergenceDetector.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/ExecutionContext.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/ExecutionContext.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/ExecutionProfiler.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/ExecutionProfiler.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/InputSource.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/InputSource.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/LockstepEngine.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/LockstepEngine.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/MTParser.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/MTParser.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/MTSimulator.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/MTSimulator.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/MachineEnumerator.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/MachineEnumerator.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/MachineProgram.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/MachineProgram.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/PageArena.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/PageArena.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/PersistentRun.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/PersistentRun.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/PersistentTape.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/PersistentTape.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/ProgressMonitor.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/ProgressMonitor.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/ResourceGovernor.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/ResourceGovernor.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/RunScheduler.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/RunScheduler.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/RunStats.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/RunStats.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/SimdKernels.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/SimdKernels.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/State.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/State.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/SymbolPattern.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/SymbolPattern.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/Tape.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/Tape.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/TapeBank.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/TapeBank.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/TapePrimitives.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/TapePrimitives.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/TapeSpill.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/TapeSpill.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/TraceWriter.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/TraceWriter.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/Transition.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/Transition.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/TransitionTable.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/TransitionTable.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/TuringMachine.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/TuringMachine.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/src/WorkerPool.cpp.o"
+  "CMakeFiles/AllocationTest.dir/src/WorkerPool.cpp.o.d"
+  "CMakeFiles/AllocationTest.dir/tests/AllocationTest.cpp.o"
+  "CMakeFiles/AllocationTest.dir/tests/AllocationTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AllocationTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
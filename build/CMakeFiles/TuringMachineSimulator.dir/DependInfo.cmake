@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Alphabet.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/Alphabet.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/Alphabet.cpp.o.d"
+  "/root/repo/src/ConfigurationStream.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/ConfigurationStream.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/ConfigurationStream.cpp.o.d"
+  "/root/repo/src/DFAScanner.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/DFAScanner.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/DFAScanner.cpp.o.d"
+  "/root/repo/src/DivergenceDetector.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/DivergenceDetector.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/DivergenceDetector.cpp.o.d"
+  "/root/repo/src/ExecutionContext.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/ExecutionContext.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/ExecutionContext.cpp.o.d"
+  "/root/repo/src/ExecutionProfiler.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/ExecutionProfiler.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/ExecutionProfiler.cpp.o.d"
+  "/root/repo/src/InputSource.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/InputSource.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/InputSource.cpp.o.d"
+  "/root/repo/src/LockstepEngine.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/LockstepEngine.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/LockstepEngine.cpp.o.d"
+  "/root/repo/src/MTParser.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/MTParser.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/MTParser.cpp.o.d"
+  "/root/repo/src/MTSimulator.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/MTSimulator.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/MTSimulator.cpp.o.d"
+  "/root/repo/src/MachineEnumerator.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/MachineEnumerator.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/MachineEnumerator.cpp.o.d"
+  "/root/repo/src/MachineProgram.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/MachineProgram.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/MachineProgram.cpp.o.d"
+  "/root/repo/src/PageArena.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/PageArena.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/PageArena.cpp.o.d"
+  "/root/repo/src/PersistentRun.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/PersistentRun.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/PersistentRun.cpp.o.d"
+  "/root/repo/src/PersistentTape.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/PersistentTape.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/PersistentTape.cpp.o.d"
+  "/root/repo/src/ProgressMonitor.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/ProgressMonitor.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/ProgressMonitor.cpp.o.d"
+  "/root/repo/src/ResourceGovernor.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/ResourceGovernor.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/ResourceGovernor.cpp.o.d"
+  "/root/repo/src/RunScheduler.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/RunScheduler.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/RunScheduler.cpp.o.d"
+  "/root/repo/src/RunStats.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/RunStats.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/RunStats.cpp.o.d"
+  "/root/repo/src/SimdKernels.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/SimdKernels.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/SimdKernels.cpp.o.d"
+  "/root/repo/src/State.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/State.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/State.cpp.o.d"
+  "/root/repo/src/SymbolPattern.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/SymbolPattern.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/SymbolPattern.cpp.o.d"
+  "/root/repo/src/Tape.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/Tape.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/Tape.cpp.o.d"
+  "/root/repo/src/TapeBank.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/TapeBank.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/TapeBank.cpp.o.d"
+  "/root/repo/src/TapePrimitives.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/TapePrimitives.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/TapePrimitives.cpp.o.d"
+  "/root/repo/src/TapeSpill.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/TapeSpill.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/TapeSpill.cpp.o.d"
+  "/root/repo/src/TraceWriter.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/TraceWriter.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/TraceWriter.cpp.o.d"
+  "/root/repo/src/Transition.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/Transition.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/Transition.cpp.o.d"
+  "/root/repo/src/TransitionTable.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/TransitionTable.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/TransitionTable.cpp.o.d"
+  "/root/repo/src/TuringMachine.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/TuringMachine.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/TuringMachine.cpp.o.d"
+  "/root/repo/src/WorkerPool.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/WorkerPool.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/WorkerPool.cpp.o.d"
+  "/root/repo/src/main.cpp" "CMakeFiles/TuringMachineSimulator.dir/src/main.cpp.o" "gcc" "CMakeFiles/TuringMachineSimulator.dir/src/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,73 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TuringMachineSimulator.dir/src/Alphabet.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/Alphabet.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/ConfigurationStream.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/ConfigurationStream.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/DFAScanner.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/DFAScanner.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/DivergenceDetector.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/DivergenceDetector.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/ExecutionContext.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/ExecutionContext.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/ExecutionProfiler.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/ExecutionProfiler.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/InputSource.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/InputSource.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/LockstepEngine.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/LockstepEngine.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/MTParser.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/MTParser.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/MTSimulator.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/MTSimulator.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/MachineEnumerator.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/MachineEnumerator.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/MachineProgram.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/MachineProgram.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/PageArena.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/PageArena.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/PersistentRun.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/PersistentRun.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/PersistentTape.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/PersistentTape.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/ProgressMonitor.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/ProgressMonitor.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/ResourceGovernor.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/ResourceGovernor.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/RunScheduler.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/RunScheduler.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/RunStats.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/RunStats.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/SimdKernels.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/SimdKernels.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/State.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/State.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/SymbolPattern.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/SymbolPattern.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/Tape.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/Tape.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/TapeBank.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/TapeBank.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/TapePrimitives.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/TapePrimitives.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/TapeSpill.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/TapeSpill.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/TraceWriter.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/TraceWriter.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/Transition.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/Transition.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/TransitionTable.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/TransitionTable.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/TuringMachine.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/TuringMachine.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/WorkerPool.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/WorkerPool.cpp.o.d"
+  "CMakeFiles/TuringMachineSimulator.dir/src/main.cpp.o"
+  "CMakeFiles/TuringMachineSimulator.dir/src/main.cpp.o.d"
+  "TuringMachineSimulator"
+  "TuringMachineSimulator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TuringMachineSimulator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
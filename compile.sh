@@ -11,7 +11,7 @@ mkdir -p build
 echo "Compilando archivos fuente..."
 
 # Compilar con g++
-g++ -std=c++17 -I./include -o build/TuringMachineSimulator \
+g++ -std=c++17 -pthread -I./include -o build/TuringMachineSimulator \
     src/main.cpp \
     src/State.cpp \
     src/Alphabet.cpp \
@@ -19,7 +19,31 @@ g++ -std=c++17 -I./include -o build/TuringMachineSimulator \
     src/Tape.cpp \
     src/TuringMachine.cpp \
     src/MTParser.cpp \
-    src/MTSimulator.cpp
+    src/MTSimulator.cpp \
+    src/DFAScanner.cpp \
+    src/LockstepEngine.cpp \
+    src/SimdKernels.cpp \
+    src/TapeSpill.cpp \
+    src/InputSource.cpp \
+    src/ConfigurationStream.cpp \
+    src/RunScheduler.cpp \
+    src/WorkerPool.cpp \
+    src/MachineEnumerator.cpp \
+    src/PersistentTape.cpp \
+    src/PersistentRun.cpp \
+    src/DivergenceDetector.cpp \
+    src/TraceWriter.cpp \
+    src/MachineProgram.cpp \
+    src/ExecutionContext.cpp \
+    src/SymbolPattern.cpp \
+    src/TapePrimitives.cpp \
+    src/ResourceGovernor.cpp \
+    src/ExecutionProfiler.cpp \
+    src/RunStats.cpp \
+    src/ProgressMonitor.cpp \
+    src/TransitionTable.cpp \
+    src/PageArena.cpp \
+    src/TapeBank.cpp
 
 # Verificar si la compilación fue exitosa
 if [ $? -eq 0 ]; then
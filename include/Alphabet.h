@@ -3,17 +3,32 @@
 
 #include <string>
 #include <set>
+#include <map>
 #include <vector>
+#include <array>
+#include <cstdint>
+#include "SimdKernels.h"
 
 /**
  * Representa un alfabeto (conjunto de símbolos)
+ *
+ * Cada símbolo tiene además un código de un byte para la cinta empaquetada:
+ * los símbolos de un carácter se codifican como ese mismo byte y los de varios
+ * caracteres reciben un byte de control libre (0x01-0x08, 0x0E-0x1F), que no
+ * puede aparecer en una entrada de texto ni dentro de una secuencia UTF-8.
  */
 class Alphabet {
 private:
     std::set<std::string> symbols;
     std::string blankSymbol;
+    std::map<std::string, uint8_t> multiCharCodes;   // Códigos de símbolos de varios caracteres
+    std::array<std::string, 256> decodeTable;        // Código -> símbolo
+    ByteSet symbolClass;                             // Símbolos de un carácter (validación)
 
 public:
+    // Bytes de control disponibles para los símbolos de varios caracteres
+    static constexpr int MAX_MULTI_CHAR_SYMBOLS = 26;
+
     /**
      * Constructor por defecto
      */
@@ -88,6 +103,43 @@ public:
      * Método auxiliar para imprimir el alfabeto
      */
     std::string toString() const;
+
+    /**
+     * Obtiene el código de un byte de un símbolo
+     * Lanza MTException si el símbolo tiene varios caracteres y no pertenece al alfabeto
+     */
+    uint8_t encode(const std::string& symbol) const;
+
+    /**
+     * Obtiene el símbolo correspondiente a un código
+     */
+    const std::string& decode(uint8_t code) const { return decodeTable[code]; }
+
+    /**
+     * Indica si hay símbolos de más de un carácter (la codificación no es la identidad)
+     */
+    bool hasMultiCharSymbols() const;
+
+    /**
+     * Tabla de 256 entradas con los símbolos de un carácter del alfabeto
+     */
+    const ByteSet& getSymbolClass() const;
+
+private:
+    /**
+     * Restaura la tabla de decodificación identidad
+     */
+    void resetCodes();
+
+    /**
+     * Asigna un byte libre a un símbolo de varios caracteres
+     */
+    void assignCode(const std::string& symbol);
+
+    /**
+     * Cambia el byte del símbolo de varios caracteres que use code, si lo hay
+     */
+    void reassignCode(uint8_t code);
 };
 
 #endif // ALPHABET_H
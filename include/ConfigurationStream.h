@@ -0,0 +1,136 @@
+#ifndef CONFIGURATION_STREAM_H
+#define CONFIGURATION_STREAM_H
+
+#include <string>
+#include <functional>
+#include <iterator>
+#include <cstddef>
+
+class TuringMachine;
+
+/**
+ * Vista ligera de la configuración actual de una máquina
+ *
+ * No copia nada: consulta la máquina en el momento de la llamada, así que
+ * solo es válida hasta que el generador avance. Las cadenas (cintas,
+ * configuración completa) se construyen solo si se piden.
+ */
+class ConfigurationView {
+private:
+    const TuringMachine* machine;
+
+public:
+    explicit ConfigurationView(const TuringMachine* tm) : machine(tm) {}
+
+    long long step() const;
+    std::string state() const;
+    int tapeCount() const;
+    long long head(int tapeIndex = 0) const;
+    bool halted() const;
+    bool accepted() const;
+
+    /**
+     * Contenido visible de una cinta (o la ventana alrededor del cabezal si la máquina tiene una)
+     */
+    std::string tape(int tapeIndex = 0) const;
+
+    /**
+     * Configuración completa, igual que en la traza
+     */
+    std::string toString() const;
+
+    const TuringMachine& getMachine() const { return *machine; }
+};
+
+/**
+ * Generador perezoso de configuraciones de una ejecución
+ *
+ * Cada llamada a next() ejecuta pasos hasta la siguiente configuración que
+ * cumple el paso (una de cada stride) y el filtro, y se detiene ahí: el
+ * consumidor decide cuánto avanza la ejecución y no se guarda ninguna traza.
+ * Se entrega siempre la configuración inicial y la final (si cumplen el
+ * filtro). También se puede recorrer con un for por rango.
+ *
+ * La máquina debe estar inicializada; el generador no es propietario de ella.
+ */
+class ConfigurationStream {
+public:
+    using Filter = std::function<bool(const ConfigurationView&)>;
+
+    /**
+     * Iterador de entrada sobre las configuraciones entregadas
+     */
+    class iterator {
+    private:
+        ConfigurationStream* stream;    // nullptr = final
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = ConfigurationView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const ConfigurationView*;
+        using reference = ConfigurationView;
+
+        explicit iterator(ConfigurationStream* owner) : stream(owner) {}
+
+        ConfigurationView operator*() const { return stream->current(); }
+        iterator& operator++();
+        bool operator==(const iterator& other) const { return stream == other.stream; }
+        bool operator!=(const iterator& other) const { return stream != other.stream; }
+    };
+
+private:
+    TuringMachine* machine;
+    long long maxSteps;
+    long long stride;
+    Filter filter;
+    long long runSteps;         // Pasos ejecutados por este generador
+    bool started;
+    bool finished;
+
+public:
+    /**
+     * Constructor de ConfigurationStream
+     * @param maxSteps Pasos como máximo, como en TuringMachine::execute()
+     */
+    ConfigurationStream(TuringMachine& tm, long long maxSteps);
+
+    /**
+     * Entrega solo una de cada k configuraciones (por número de paso)
+     */
+    ConfigurationStream& every(long long k);
+
+    /**
+     * Entrega solo las configuraciones que cumplen el filtro
+     */
+    ConfigurationStream& where(Filter predicate);
+
+    /**
+     * Avanza hasta la siguiente configuración entregada
+     * @return false si la ejecución terminó sin más configuraciones
+     */
+    bool next();
+
+    /**
+     * Configuración en la que se detuvo el último next()
+     */
+    ConfigurationView current() const { return ConfigurationView(machine); }
+
+    /**
+     * true si la ejecución ya no puede avanzar (parada, límite o pasos agotados)
+     */
+    bool isFinished() const { return finished; }
+
+    iterator begin();
+    iterator end() { return iterator(nullptr); }
+
+private:
+    /**
+     * Ejecuta un paso; false si la ejecución no puede seguir
+     */
+    bool advance();
+
+    bool accepts(bool last) const;
+};
+
+#endif // CONFIGURATION_STREAM_H
@@ -0,0 +1,77 @@
+#ifndef DFA_SCANNER_H
+#define DFA_SCANNER_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "State.h"
+
+class TuringMachine;
+
+/**
+ * Autómata finito extraído de una MT monocinta que solo se mueve a la derecha
+ *
+ * Si todas las transiciones alcanzables desde q0 mueven el cabezal a la derecha,
+ * la máquina nunca vuelve a leer lo que escribe: es un AFD sobre la entrada
+ * seguido de una cola determinista sobre blancos. Esta clase compila esa MT en
+ * una tabla plana estado x byte y la ejecuta directamente sobre la cadena de
+ * entrada, reproduciendo exactamente pasos, estado final y cinta del motor
+ * de referencia (TuringMachine::executeStep).
+ */
+class DFAScanner {
+public:
+    /**
+     * Resultado de una ejecución sobre el AFD
+     */
+    struct Result {
+        long long steps;        // Pasos ejecutados
+        int finalState;         // Índice del estado final
+        bool accepted;          // Se alcanzó un estado de aceptación
+        bool halted;            // La máquina se detuvo (aceptación o sin transición)
+        std::string cells;      // Celdas finales escritas (incluye blancos de relleno)
+        long long headPosition; // Posición final del cabezal
+    };
+
+private:
+    /**
+     * Entrada de la tabla de transición (estado, byte leído)
+     */
+    struct Entry {
+        int32_t next;           // Estado siguiente (-1 si no hay transición)
+        char write;             // Símbolo escrito
+    };
+
+    std::vector<State> stateList;           // Estados indexados por id
+    std::vector<Entry> table;               // numStates * 256 entradas
+    std::vector<char> accepting;            // accepting[s] != 0 si s ∈ F
+    std::vector<std::string> loopBytes;     // Bytes que forman un bucle identidad en cada estado
+    int initialState;
+    char blank;
+
+    DFAScanner();
+
+public:
+    /**
+     * Compila la MT en un AFD si es reducible
+     * @return Nuevo DFAScanner o nullptr si la máquina no cumple las condiciones
+     */
+    static DFAScanner* compile(const TuringMachine& tm);
+
+    /**
+     * Ejecuta el AFD sobre la entrada con el mismo límite de pasos que execute()
+     */
+    Result run(const std::string& input, long long maxSteps) const;
+
+    /**
+     * Obtiene el estado correspondiente a un índice
+     */
+    const State& getState(int index) const;
+
+private:
+    /**
+     * Longitud del prefijo de data formado solo por bytes de bucle del estado
+     */
+    size_t loopSpan(int state, const char* data, size_t length) const;
+};
+
+#endif // DFA_SCANNER_H
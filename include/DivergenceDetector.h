@@ -0,0 +1,124 @@
+#ifndef DIVERGENCE_DETECTOR_H
+#define DIVERGENCE_DETECTOR_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "TapeBank.h"
+
+/**
+ * Detector de ejecuciones que no terminan: ciclos y ciclos trasladados
+ *
+ * En los pasos potencia de 2 se toma un ancla: el estado, la posición de cada
+ * cabezal y las celdas cercanas. Si más adelante vuelve el mismo estado, cada
+ * cabezal se ha desplazado d celdas y la zona que la máquina ha recorrido desde
+ * el ancla coincide, desplazada d, con la que había en el ancla (incluyendo,
+ * en el sentido del desplazamiento, todo lo que queda hasta el blanco infinito),
+ * el tramo se repetirá igual para siempre: la ejecución diverge. Con d = 0 en
+ * todas las cintas es un ciclo exacto; el caso típico es un bucle que avanza
+ * por la cinta en blanco (p. ej. moverse a la derecha sobre '.').
+ *
+ * El periodo que se detecta con un ancla llega hasta la distancia al ancla
+ * siguiente, así que cualquier periodo acaba detectándose. Las comparaciones
+ * se limitan a unas pocas celdas por paso ejecutado y el seguimiento por paso
+ * es un mínimo y un máximo por cinta.
+ */
+class DivergenceDetector {
+public:
+    // Celdas que se guardan a cada lado del cabezal en el ancla
+    static constexpr long long WINDOW = 1 << 16;
+
+private:
+    /**
+     * Cinta en el ancla
+     */
+    struct TapeAnchor {
+        long long head;                 // Posición absoluta del cabezal
+        uint8_t blank;
+        long long leftEdge;             // Extensión alcanzada [leftEdge, rightEdge)
+        long long rightEdge;
+        long long first;                // Celdas guardadas [first, first + cells.size()): la ventana
+                                        // [head - WINDOW, head + WINDOW] dentro de la extensión
+        std::vector<uint8_t> cells;
+        long long minHead;              // Recorrido del cabezal desde el ancla
+        long long maxHead;
+    };
+
+    bool active;
+    std::vector<TapeAnchor> anchors;
+    int anchorState;
+    std::vector<uint8_t> anchorCodes;   // Símbolos bajo los cabezales en el ancla
+    std::vector<uint8_t> currentCodes;
+    long long anchorStep;
+    long long nextAnchor;               // Paso en el que se toma el siguiente ancla
+    long long budget;                   // Celdas que aún se pueden comparar
+    long long pendingCost;              // Celdas de la última comparación que no cupo o falló
+    std::vector<uint8_t> scratch;
+    std::string reason;
+
+public:
+    /**
+     * Constructor de DivergenceDetector (inactivo)
+     */
+    DivergenceDetector();
+
+    /**
+     * Prepara una ejecución nueva
+     * @param enabled false desactiva el detector hasta el siguiente reset()
+     */
+    void reset(bool enabled);
+
+    bool isActive() const { return active; }
+
+    /**
+     * Se llama tras cada paso con el estado alcanzado
+     * @return true si queda demostrado que la ejecución no termina
+     */
+    bool observe(long long step, int state, const TapeBank& tapes) {
+        budget += COMPARE_PER_STEP;
+        if (step >= nextAnchor) {
+            anchor(step, state, tapes);
+            return false;
+        }
+        for (size_t i = 0; i < anchors.size(); i++) {
+            const long long head = tapes.cursor(static_cast<int>(i)).head;
+            TapeAnchor& tape = anchors[i];
+            if (head < tape.minHead) {
+                tape.minHead = head;
+            } else if (head > tape.maxHead) {
+                tape.maxHead = head;
+            }
+        }
+        if (state != anchorState || budget < pendingCost) {
+            return false;
+        }
+        // Descarte barato: el símbolo bajo cada cabezal debe ser el del ancla
+        tapes.readCodes(currentCodes.data());
+        return currentCodes == anchorCodes && repeats(step, tapes);
+    }
+
+    /**
+     * Descripción del ciclo encontrado (vacía si no se ha encontrado)
+     */
+    const std::string& getReason() const { return reason; }
+
+private:
+    static constexpr long long COMPARE_PER_STEP = 4;
+
+    /**
+     * Guarda la configuración actual como ancla
+     */
+    void anchor(long long step, int state, const TapeBank& tapes);
+
+    /**
+     * Celdas [first, last] que deben repetirse desplazadas shift posiciones
+     */
+    static void span(const TapeAnchor& saved, long long shift, long long& first, long long& last);
+
+    /**
+     * Comprueba si la configuración actual repite la del ancla desplazada
+     */
+    bool repeats(long long step, const TapeBank& tapes);
+};
+
+#endif // DIVERGENCE_DETECTOR_H
@@ -0,0 +1,125 @@
+#ifndef EXECUTION_CONTEXT_H
+#define EXECUTION_CONTEXT_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "MachineProgram.h"
+#include "TapeBank.h"
+#include "ResourceGovernor.h"
+#include "DivergenceDetector.h"
+
+/**
+ * Estado de una ejecución sobre un MachineProgram compartido
+ *
+ * Contiene solo lo que cambia al ejecutar: estado actual, cintas, contadores,
+ * presupuesto y detector de ciclos. Avanza con la tabla compilada igual que
+ * TuringMachine::executeStep() (mismos veredictos de límite y divergencia).
+ * reset() prepara otra entrada reutilizando las cintas y sus páginas, así que
+ * un contexto por hilo puede encadenar ejecuciones sin volver a reservar.
+ *
+ * Cada contexto es de un solo hilo; varios contextos pueden compartir el mismo
+ * programa desde hilos distintos. No incluye el perfilador, el AFD ni la
+ * entrada leída bajo demanda de TuringMachine.
+ */
+class ExecutionContext {
+private:
+    std::shared_ptr<const MachineProgram> program;
+    const TransitionTable* table;
+    ResourceBudget budget;              // Antes que las cintas: se destruye después que ellas
+    TapeBank tapes;
+    std::vector<uint8_t> readBuffer;
+    std::vector<uint8_t> primitiveBuffer;
+    DivergenceDetector divergence;
+    bool divergenceCheck;
+    size_t spillResidentPages;          // 0 = sin volcado a disco
+    std::string spillDirectory;
+    bool nativePrimitives;              // Bucles de TapePrimitives de una vez en run()
+
+    int stateId;
+    long long stepCount;
+    long long lookupCount;
+    bool accepted;
+    bool halted;
+    bool limitExceeded;
+    bool diverged;
+    std::string limitReason;
+
+public:
+    /**
+     * Contexto sobre un programa compilado; las cintas se crean en el primer reset()
+     */
+    explicit ExecutionContext(std::shared_ptr<const MachineProgram> compiled);
+
+    ExecutionContext(const ExecutionContext&) = delete;
+    ExecutionContext& operator=(const ExecutionContext&) = delete;
+
+    /**
+     * Presupuesto de pasos, celdas y memoria de cada ejecución
+     */
+    void setResourceLimits(const ResourceLimits& limits);
+
+    /**
+     * Detiene las ejecuciones que se demuestra que no terminan (véase TuringMachine)
+     */
+    void setDivergenceCheck(bool enabled);
+
+    /**
+     * Volcado a disco de las páginas frías; se aplica en el siguiente reset()
+     */
+    void setTapeSpill(size_t maxResidentPages, const std::string& directory);
+
+    /**
+     * Permite que run() ejecute de una vez las primitivas nativas (véase TuringMachine::executeSteps())
+     */
+    void setNativePrimitives(bool enabled);
+
+    /**
+     * Prepara una ejecución con la entrada en la primera cinta
+     */
+    void reset(const std::string& input);
+
+    /**
+     * Aplica una transición
+     * @return false si la máquina se detiene (sin transición, aceptación previa, límite)
+     */
+    bool step();
+
+    /**
+     * Avanza hasta detenerse o dar maxSteps pasos
+     * @return true si la entrada fue aceptada
+     */
+    bool run(long long maxSteps);
+
+    /**
+     * reset(input) seguido de run(maxSteps)
+     */
+    bool execute(const std::string& input, long long maxSteps);
+
+    const MachineProgram& getProgram() const { return *program; }
+    long long getStepCount() const { return stepCount; }
+    long long getTransitionLookups() const { return lookupCount; }
+    bool isHalted() const { return halted; }
+    bool wasAccepted() const { return accepted; }
+    bool exceededLimits() const { return limitExceeded; }
+    const std::string& getLimitReason() const { return limitReason; }
+    bool hasDiverged() const { return diverged; }
+    const std::string& getDivergenceReason() const { return divergence.getReason(); }
+    const ResourceBudget& getResourceBudget() const { return budget; }
+    int getStateId() const { return stateId; }
+    const std::string& getStateName() const;
+    int getTapeCount() const { return tapes.size(); }
+    std::string getTapeContent(int tapeIndex = 0) const;
+    long long getHeadPosition(int tapeIndex = 0) const;
+
+    /**
+     * Misma representación que TuringMachine::getConfiguration() con la cinta completa
+     */
+    std::string getConfiguration() const;
+
+private:
+    void stopForLimit(const std::string& reason);
+};
+
+#endif // EXECUTION_CONTEXT_H
@@ -0,0 +1,188 @@
+#ifndef EXECUTION_OBSERVERS_H
+#define EXECUTION_OBSERVERS_H
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <type_traits>
+#include "TuringMachine.h"
+#include "TraceWriter.h"
+
+/**
+ * Observadores del bucle de ejecución de MTSimulator
+ *
+ * MTSimulator::run(input, maxSteps, observer) es una plantilla sobre el tipo
+ * del observador: llama a observer.begin(tm) con la configuración inicial, a
+ * observer.step(tm) tras cada paso y a observer.end(tm) al terminar. Los
+ * métodos se resuelven en compilación, así que con NoObserver el bucle queda
+ * reducido a ejecutar pasos y un observador solo cuesta lo que hace en step().
+ *
+ * Cualquier clase con esos tres métodos sirve de observador. Los que no miran
+ * los pasos intermedios lo declaran con OBSERVES_STEPS = false y el bucle
+ * puede entonces ejecutar tramos enteros de una vez (TapePrimitives).
+ */
+
+/**
+ * Valor de Observer::OBSERVES_STEPS (true si no lo declara)
+ */
+template <class Observer, class = void>
+struct ObservesSteps : std::true_type {};
+
+template <class Observer>
+struct ObservesSteps<Observer, std::void_t<decltype(Observer::OBSERVES_STEPS)>>
+    : std::integral_constant<bool, Observer::OBSERVES_STEPS> {};
+
+/**
+ * Sin observador: el bucle de pasos sin nada más
+ */
+struct NoObserver {
+    static constexpr bool OBSERVES_STEPS = false;
+
+    void begin(const TuringMachine&) {}
+    void step(const TuringMachine&) {}
+    void end(const TuringMachine&) {}
+};
+
+/**
+ * Guarda solo la configuración inicial y la final
+ */
+class SummaryObserver {
+private:
+    std::vector<std::string>& trace;
+
+public:
+    static constexpr bool OBSERVES_STEPS = false;
+
+    explicit SummaryObserver(std::vector<std::string>& out) : trace(out) {}
+
+    void begin(const TuringMachine& tm) { trace.push_back(tm.getConfiguration()); }
+    void step(const TuringMachine&) {}
+    void end(const TuringMachine& tm) {
+        if (tm.getStepCount() > 0) {
+            trace.push_back(tm.getConfiguration());
+        }
+    }
+};
+
+/**
+ * Guarda la configuración de cada paso (la memoria crece con la ejecución)
+ */
+class FullTraceObserver {
+private:
+    std::vector<std::string>& trace;
+
+public:
+    explicit FullTraceObserver(std::vector<std::string>& out) : trace(out) {}
+
+    void begin(const TuringMachine& tm) { trace.push_back(tm.getConfiguration()); }
+    void step(const TuringMachine& tm) { trace.push_back(tm.getConfiguration()); }
+    void end(const TuringMachine&) {}
+};
+
+/**
+ * Escribe la traza durante la ejecución con un TraceWriter
+ */
+class TraceWriterObserver {
+private:
+    TraceWriter& writer;
+
+public:
+    explicit TraceWriterObserver(TraceWriter& out) : writer(out) {}
+
+    void begin(const TuringMachine& tm) { writer.begin(tm); }
+    void step(const TuringMachine& tm) { writer.record(tm); }
+    void end(const TuringMachine& tm) { writer.finish(tm); }
+};
+
+/**
+ * Cuenta las configuraciones de cada estado (la inicial incluida), por
+ * índice de estado de la tabla compilada: TransitionTable::getState(i)
+ */
+class StateCounter {
+private:
+    std::vector<long long> visits;
+
+public:
+    void begin(const TuringMachine& tm) {
+        visits.clear();
+        step(tm);
+    }
+    void step(const TuringMachine& tm) {
+        const int state = tm.getCurrentStateId();
+        if (state < 0) {
+            return;
+        }
+        if (static_cast<size_t>(state) >= visits.size()) {
+            visits.resize(static_cast<size_t>(state) + 1, 0);
+        }
+        visits[static_cast<size_t>(state)]++;
+    }
+    void end(const TuringMachine&) {}
+
+    const std::vector<long long>& getVisits() const { return visits; }
+};
+
+/**
+ * Funciones arbitrarias en cada punto de la ejecución (las vacías no se llaman)
+ * Cuesta una llamada indirecta por paso; para observadores frecuentes es
+ * mejor una clase propia
+ */
+class CallbackObserver {
+public:
+    using Callback = std::function<void(const TuringMachine&)>;
+
+private:
+    Callback onBegin;
+    Callback onStep;
+    Callback onEnd;
+
+public:
+    CallbackObserver(Callback beginCallback, Callback stepCallback, Callback endCallback)
+        : onBegin(std::move(beginCallback)), onStep(std::move(stepCallback)), onEnd(std::move(endCallback)) {}
+
+    void begin(const TuringMachine& tm) {
+        if (onBegin) {
+            onBegin(tm);
+        }
+    }
+    void step(const TuringMachine& tm) {
+        if (onStep) {
+            onStep(tm);
+        }
+    }
+    void end(const TuringMachine& tm) {
+        if (onEnd) {
+            onEnd(tm);
+        }
+    }
+};
+
+/**
+ * Dos observadores a la vez (se pueden anidar para más)
+ */
+template <class First, class Second>
+class ObserverPair {
+private:
+    First& first;
+    Second& second;
+
+public:
+    static constexpr bool OBSERVES_STEPS = ObservesSteps<First>::value || ObservesSteps<Second>::value;
+
+    ObserverPair(First& a, Second& b) : first(a), second(b) {}
+
+    void begin(const TuringMachine& tm) {
+        first.begin(tm);
+        second.begin(tm);
+    }
+    void step(const TuringMachine& tm) {
+        first.step(tm);
+        second.step(tm);
+    }
+    void end(const TuringMachine& tm) {
+        first.end(tm);
+        second.end(tm);
+    }
+};
+
+#endif // EXECUTION_OBSERVERS_H
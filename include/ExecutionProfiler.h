@@ -0,0 +1,60 @@
+#ifndef EXECUTION_PROFILER_H
+#define EXECUTION_PROFILER_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+class TuringMachine;
+
+/**
+ * Perfilador de ejecución: un contador por transición, indexado por su id
+ *
+ * En el bucle de ejecución solo se incrementa un contador por paso; los
+ * totales por estado, por tipo de movimiento y los bucles entre estados se
+ * derivan al generar el informe, porque cada transición tiene estado de
+ * origen, destino y direcciones fijos.
+ *
+ * Solo se compila dentro de TuringMachine con MT_ENABLE_PROFILER definido.
+ */
+class ExecutionProfiler {
+private:
+    std::vector<unsigned long long> transitionHits;
+
+public:
+    /**
+     * Pone a cero los contadores para una máquina con n transiciones
+     */
+    void reset(size_t transitionCount);
+
+    /**
+     * Registra la ejecución de una transición
+     */
+    void recordTransition(int transitionId) {
+        ++transitionHits[static_cast<size_t>(transitionId)];
+    }
+
+    /**
+     * Veces que se ejecutó una transición
+     */
+    unsigned long long getTransitionHits(int transitionId) const;
+
+    /**
+     * Total de transiciones registradas
+     */
+    unsigned long long getTotalHits() const;
+
+    /**
+     * Informe ordenado: transiciones, estados, movimientos y bucles más frecuentes
+     * @param top Número de entradas de cada lista
+     */
+    std::string report(const TuringMachine& tm, size_t top = 10) const;
+};
+
+#ifdef MT_ENABLE_PROFILER
+#define MT_PROFILE_TRANSITION(profiler, id) (profiler).recordTransition(id)
+#else
+#define MT_PROFILE_TRANSITION(profiler, id) ((void)0)
+#endif
+
+#endif // EXECUTION_PROFILER_H
@@ -0,0 +1,82 @@
+#ifndef INPUT_SOURCE_H
+#define INPUT_SOURCE_H
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Origen de la entrada para cintas que se llenan bajo demanda
+ *
+ * Lee de un archivo o de la entrada estándar (también tuberías) por bloques, a
+ * medida que el cabezal de la primera cinta avanza más allá de lo cargado. Los
+ * bytes se usan tal cual como celdas, igual que una entrada en la línea de
+ * órdenes, salvo un salto de línea final ("\n" o "\r\n"), que se descarta
+ * para que echo y los archivos de texto den la misma cinta que la entrada
+ * escrita a mano. Un salto de línea se retiene hasta saber si sigue algo.
+ */
+class InputSource {
+public:
+    /**
+     * Bytes de buffer tras los entregados que read() puede dejar modificados
+     * (el salto de línea retenido)
+     */
+    static constexpr size_t MAX_HELD = 2;
+
+private:
+    int fileDescriptor;
+    bool ownsDescriptor;
+    bool finished;          // Se alcanzó el final de la entrada
+    long long bytesRead;
+    std::string name;
+    uint8_t held[MAX_HELD + 1];  // Leídos pero no entregados (salto de línea que puede ser el final)
+    size_t heldCount;
+
+    /**
+     * Lee del descriptor hasta capacity bytes (0 al final de la entrada)
+     */
+    size_t readRaw(uint8_t* buffer, size_t capacity);
+
+    /**
+     * Al final de la entrada: entrega lo retenido salvo el salto de línea final
+     */
+    size_t releaseHeld(uint8_t* buffer, size_t capacity);
+
+public:
+    /**
+     * Abre el origen: "-" es la entrada estándar
+     * Lanza MTException si no se puede abrir
+     */
+    explicit InputSource(const std::string& path);
+
+    /**
+     * Cierra el archivo (la entrada estándar se deja abierta)
+     */
+    ~InputSource();
+
+    InputSource(const InputSource&) = delete;
+    InputSource& operator=(const InputSource&) = delete;
+
+    /**
+     * Lee hasta capacity bytes; espera hasta tener alguno o llegar al final
+     * @return Bytes entregados (0 solo al final de la entrada)
+     */
+    size_t read(uint8_t* buffer, size_t capacity);
+
+    /**
+     * true si ya no quedan bytes por leer
+     */
+    bool isFinished() const { return finished && heldCount == 0; }
+
+    /**
+     * Bytes entregados hasta ahora
+     */
+    long long getBytesRead() const { return bytesRead; }
+
+    /**
+     * Nombre del origen (ruta o "-")
+     */
+    const std::string& getName() const { return name; }
+};
+
+#endif // INPUT_SOURCE_H
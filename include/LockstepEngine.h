@@ -0,0 +1,75 @@
+#ifndef LOCKSTEP_ENGINE_H
+#define LOCKSTEP_ENGINE_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "State.h"
+
+class TuringMachine;
+
+/**
+ * Ejecución simultánea de muchas entradas de una misma MT monocinta
+ *
+ * Avanza LANES ejecuciones independientes a la vez. Cada lane tiene su estado,
+ * su cabezal y su cinta; en cada paso se calculan los índices (estado, símbolo)
+ * de todas las lanes y la tabla de transición compilada se consulta con un
+ * gather vectorial (SimdKernels::gather32). La escritura y el movimiento se
+ * aplican solo a las lanes activas, y cada lane que termina se rellena con la
+ * siguiente entrada de la cola. Reproduce pasos, veredicto, estado final,
+ * cinta y cabezal de TuringMachine::execute().
+ */
+class LockstepEngine {
+public:
+    static constexpr int LANES = 16;
+
+    /**
+     * Resultado de una entrada
+     */
+    struct Result {
+        bool accepted;              // Se alcanzó un estado de aceptación
+        bool halted;                // La máquina se detuvo (aceptación o sin transición)
+        long long steps;            // Pasos ejecutados
+        int finalState;             // Índice del estado final
+        long long headPosition;     // Como Tape::getHeadPosition()
+        std::string tape;           // Contenido visible (como Tape::getVisibleContent())
+    };
+
+private:
+    // Entrada de la tabla: (siguiente << 10) | (código escrito << 2) | movimiento
+    // (0 = L, 1 = S, 2 = R); -1 si no hay transición
+    std::vector<int32_t> table;             // numStates * 256 + 1 (centinela para lanes vacías)
+    std::vector<State> stateList;
+    std::vector<char> accepting;
+    std::vector<std::string> decodeTable;   // Código -> símbolo
+    int initialState;
+    uint8_t blankCode;
+
+    LockstepEngine();
+
+public:
+    /**
+     * Compila la máquina para el motor por lanes
+     * @return nullptr si la máquina no es monocinta o algún símbolo no tiene código
+     */
+    static LockstepEngine* compile(const TuringMachine& tm);
+
+    /**
+     * Ejecuta todas las entradas con el mismo límite de pasos que execute()
+     * @return Un resultado por entrada, en el mismo orden
+     */
+    std::vector<Result> run(const std::vector<std::string>& inputs, long long maxSteps) const;
+
+    /**
+     * Obtiene el estado correspondiente a un índice
+     */
+    const State& getState(int index) const;
+
+private:
+    /**
+     * Contenido visible de la cinta de una lane
+     */
+    std::string visibleContent(const std::vector<uint8_t>& cells) const;
+};
+
+#endif // LOCKSTEP_ENGINE_H
@@ -19,4 +19,13 @@ public:
     }
 };
 
+/**
+ * Excepción lanzada cuando una ejecución supera su presupuesto de recursos
+ * (pasos, celdas de cinta o memoria)
+ */
+class ResourceLimitException : public MTException {
+public:
+    explicit ResourceLimitException(const std::string& msg) : MTException(msg) {}
+};
+
 #endif // MTEXCEPTION_H
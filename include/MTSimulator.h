@@ -3,7 +3,25 @@
 
 #include <string>
 #include <vector>
+#include <chrono>
+#include <algorithm>
 #include "TuringMachine.h"
+#include "RunStats.h"
+#include "ConfigurationStream.h"
+#include "RunScheduler.h"
+#include "PersistentRun.h"
+#include "ProgressMonitor.h"
+#include "InputSource.h"
+#include "ExecutionObservers.h"
+
+/**
+ * Traza que guarda run() sin observador explícito ni escritor de traza
+ */
+enum class TracePolicy {
+    None,       // Nada: el bucle de pasos sin coste añadido
+    Summary,    // Configuración inicial y final
+    Full        // Todas las configuraciones
+};
 
 /**
  * Ejecutor y visualizador del simulador de Máquinas de Turing
@@ -13,6 +31,22 @@ class MTSimulator {
 private:
     TuringMachine* machine;
     std::vector<std::string> executionTrace;
+    size_t spillResidentPages;      // 0 = sin volcado a disco
+    std::string spillDirectory;
+    ResourceLimits resourceLimits;
+    std::string machineFile;
+    double loadTimeMs;
+    RunStats lastStats;
+    ProgressMonitor* progress;      // Opcional, no es propiedad del simulador
+    TraceWriter* traceWriter;       // Traza durante la ejecución (opcional, no es propiedad del simulador)
+    long long tapeWindow;           // Celdas a cada lado del cabezal en la traza (0 = cinta completa)
+    int tapeOutput;                 // Descriptor al que se vuelcan las cintas finales (-1 = en el resultado)
+    std::string tapeOutputName;
+    bool divergenceCheck;           // Detener las ejecuciones que se demuestra que no terminan
+    bool nativePrimitives;          // Bucles de búsqueda, copia y comparación de una vez (TapePrimitives)
+    TracePolicy tracePolicy;
+    bool countStates;               // Contar las configuraciones de cada estado en run()
+    StateCounter stateCounter;
 
 public:
     /**
@@ -30,10 +64,142 @@ public:
      */
     bool loadMachine(const std::string& filename);
 
+    /**
+     * Configura el volcado a disco de páginas frías de la cinta
+     */
+    void setTapeSpill(size_t maxResidentPages, const std::string& directory);
+
+    /**
+     * Establece el presupuesto de recursos de cada ejecución
+     */
+    void setResourceLimits(const ResourceLimits& limits);
+
+    /**
+     * Muestra en la traza solo radius celdas a cada lado de cada cabezal (0 = cinta completa)
+     */
+    void setTapeWindow(long long radius);
+
+    /**
+     * Detiene con el resultado DIVERGE las ejecuciones que repiten su
+     * configuración, exacta o desplazada sobre cinta en blanco
+     */
+    void setDivergenceCheck(bool enabled);
+
+    /**
+     * Ejecuta de una vez los bucles de búsqueda, copia y comparación cuando
+     * nada mira los pasos intermedios (activado por defecto)
+     */
+    void setNativePrimitives(bool enabled);
+
+    /**
+     * Escribe las cintas finales directamente en un descriptor en lugar de construirlas en memoria
+     * Con el descriptor 1 (salida estándar) se escriben en su sitio dentro del resultado; con
+     * otro descriptor se escribe cada cinta seguida de un salto de línea (-1 para desactivarlo)
+     * @param name Nombre del destino que se muestra en el resultado
+     */
+    void setTapeOutput(int fd, const std::string& name);
+
+    /**
+     * Asocia un monitor de progreso (nullptr para desactivarlo)
+     */
+    void setProgressMonitor(ProgressMonitor* monitor);
+
+    /**
+     * Escribe la traza de run() durante la ejecución con writer en lugar de
+     * guardarla (nullptr para volver a guardarla en getExecutionTrace())
+     */
+    void setTraceWriter(TraceWriter* writer);
+
+    /**
+     * Qué guarda run() en getExecutionTrace() (por defecto todas las configuraciones)
+     * Con entrada leída bajo demanda, Full guarda solo la inicial y la final
+     */
+    void setTracePolicy(TracePolicy policy);
+
+    /**
+     * Cuenta en run() las configuraciones de cada estado (véase printStateCounts())
+     */
+    void setStateCounting(bool enabled);
+
     /**
      * Ejecuta la máquina con una entrada específica
      */
-    bool run(const std::string& input, int maxSteps = 10000);
+    bool run(const std::string& input, long long maxSteps = 10000);
+
+    /**
+     * Ejecuta la máquina con una entrada que se lee bajo demanda de un archivo o tubería
+     * Sin escritor de traza, la traza guarda solo el estado inicial y el final
+     */
+    bool run(InputSource& source, long long maxSteps = 10000);
+
+    /**
+     * Ejecuta la máquina con un observador propio en lugar de la traza
+     * configurada (véase ExecutionObservers.h); getExecutionTrace() queda vacía
+     */
+    template <class Observer>
+    bool run(const std::string& input, long long maxSteps, Observer& observer);
+
+    template <class Observer>
+    bool run(InputSource& source, long long maxSteps, Observer& observer);
+
+    /**
+     * Ejecuta la máquina imprimiendo la traza a medida que avanza, una de cada
+     * stride configuraciones (más la inicial y la final), sin guardarla
+     * (un TraceWriter de texto sobre la salida estándar)
+     */
+    bool runStreamed(const std::string& input, long long maxSteps, long long stride);
+
+    /**
+     * Prepara una ejecución y devuelve un generador perezoso de sus configuraciones
+     * La ejecución avanza solo cuando se piden configuraciones; las estadísticas
+     * de getLastStats() no se actualizan
+     */
+    ConfigurationStream configurations(const std::string& input, long long maxSteps = 10000);
+
+    /**
+     * Ejecuta la entrada sobre cintas persistentes y guarda una de cada every
+     * configuraciones (más la inicial y la final). Cada una es una instantánea
+     * O(1) que comparte con las demás las celdas que no cambian, y puede
+     * seguir ejecutándose por separado. El presupuesto de pasos se respeta.
+     */
+    std::vector<PersistentRun> recordHistory(const std::string& input, long long maxSteps, long long every);
+
+    /**
+     * Imprime el historial de recordHistory() y los trozos de cinta que ocupa
+     */
+    void printHistory(const std::string& input, long long maxSteps, long long every);
+
+    /**
+     * Ejecuta un lote de entradas con el motor por lanes (LockstepEngine) e
+     * imprime el resultado de cada una
+     * @param verify Repite cada entrada con TuringMachine::execute() y avisa de discrepancias
+     * @return false si la máquina o los límites no admiten el motor (no se ejecuta nada)
+     */
+    bool runLockstep(const std::vector<std::string>& inputs, long long maxSteps, bool verify);
+
+    /**
+     * Repite la última ejecución de input paso a paso, sin primitivas nativas,
+     * e imprime si el resultado coincide (pasos, estado, cintas y cabezales)
+     * @return true si coincide
+     */
+    bool checkPrimitives(const std::string& input, long long maxSteps);
+
+    /**
+     * Ejecuta las entradas a la vez en un grupo de hilos, por porciones de
+     * sliceSteps pasos, e imprime el resultado de cada una en orden
+     * Cada entrada usa su propio ExecutionContext sobre un único MachineProgram (sin traza ni estadísticas)
+     * @param workers Hilos del grupo (0 = los núcleos disponibles)
+     */
+    void runScheduled(const std::vector<std::string>& inputs, long long maxSteps, int workers,
+                      long long sliceSteps, SchedulingPolicy policy);
+
+    /**
+     * Reparte las entradas entre procesos trabajadores que comparten la máquina
+     * ya cargada e imprime el resultado de cada una en orden
+     * @param processes Procesos trabajadores (0 = los núcleos disponibles)
+     * @return false si la plataforma no admite procesos trabajadores (no se ejecuta nada)
+     */
+    bool runProcesses(const std::vector<std::string>& inputs, long long maxSteps, int processes);
 
     /**
      * Ejecuta la máquina paso a paso (una transición por llamada)
@@ -45,6 +211,11 @@ public:
      */
     const std::vector<std::string>& getExecutionTrace() const;
 
+    /**
+     * Estadísticas de la última ejecución
+     */
+    const RunStats& getLastStats() const;
+
     /**
      * Imprime el estado actual de la máquina
      */
@@ -65,21 +236,129 @@ public:
      */
     void printResult() const;
 
+    /**
+     * Imprime las configuraciones de cada estado de la última ejecución con setStateCounting()
+     */
+    void printStateCounts();
+
+    /**
+     * Imprime el perfil de la última ejecución (requiere MT_ENABLE_PROFILER)
+     */
+    void printProfile() const;
+
     /**
      * Imprime toda la información de la máquina
      */
     void printMachineInfo() const;
 
 private:
+    /**
+     * Bucle de ejecución de run()
+     * @param input Entrada ya cargada en la cinta (nullptr si se lee bajo demanda): sin
+     *              observador de pasos, la máquina puede recorrerla con el AFD
+     */
+    template <class Observer>
+    void runSteps(long long maxSteps, Observer& observer, const std::string* input);
+
+    /**
+     * Comprueba que hay máquina y prepara la traza y el monitor para una ejecución
+     */
+    bool beginRun();
+
+    /**
+     * Llama a body con el observador de la traza elegida (más el contador de estados si está activo)
+     */
+    template <class Body>
+    bool observed(TracePolicy policy, Body body);
+
+    template <class Observer, class Body>
+    bool counted(Observer& observer, Body& body);
+
+    /**
+     * Recoge las estadísticas de la ejecución terminada
+     */
+    void finishRun(long long inputLength, std::chrono::steady_clock::time_point start);
+
     /**
      * Agrega una entrada a la traza
      */
     void recordStep();
 
+    /**
+     * Imprime las cintas finales de una ejecución en lote con el formato de printResult()
+     */
+    static void printFinalTapes(const std::vector<std::string>& tapes);
+
+    /**
+     * Imprime el contenido de una cinta final (por el volcado directo si está activo),
+     * indicando si la entrada ya leída se liberó durante la ejecución
+     */
+    void printTapeContent(int tapeIndex) const;
+
     /**
      * Crea una representación visual de la cinta
      */
     std::string visualizeTape() const;
 };
 
+template <class Observer>
+bool MTSimulator::run(const std::string& input, long long maxSteps, Observer& observer) {
+    const auto start = std::chrono::steady_clock::now();
+    if (!beginRun()) {
+        return false;
+    }
+    machine->initialize(input);
+    runSteps(maxSteps, observer, &input);
+    finishRun(static_cast<long long>(input.size()), start);
+    return machine->wasAccepted();
+}
+
+template <class Observer>
+bool MTSimulator::run(InputSource& source, long long maxSteps, Observer& observer) {
+    const auto start = std::chrono::steady_clock::now();
+    if (!beginRun()) {
+        return false;
+    }
+    machine->initialize(source);
+    runSteps(maxSteps, observer, nullptr);
+    finishRun(source.getBytesRead(), start);
+    return machine->wasAccepted();
+}
+
+template <class Observer>
+void MTSimulator::runSteps(long long maxSteps, Observer& observer, const std::string* input) {
+    observer.begin(*machine);
+    if constexpr (!ObservesSteps<Observer>::value) {
+        if (input != nullptr && machine->scanInput(*input, maxSteps)) {
+            observer.end(*machine);
+            return;
+        }
+        // Nadie mira los pasos intermedios: tramos con las primitivas nativas, el progreso entre tramos
+        long long done = 0;
+        while (done < maxSteps && !machine->isHalted()) {
+            const long long taken = machine->executeSteps(
+                std::min(maxSteps - done, ProgressMonitor::CHECK_INTERVAL - done % ProgressMonitor::CHECK_INTERVAL));
+            if (taken == 0) {
+                break;
+            }
+            done += taken;
+            if (progress != nullptr && progress->pending()) {
+                progress->snapshot(*machine);
+            }
+        }
+        observer.end(*machine);
+        return;
+    }
+    for (long long i = 0; i < maxSteps && !machine->isHalted(); i++) {
+        if (!machine->executeStep()) {
+            break;
+        }
+        observer.step(*machine);
+        if (progress != nullptr && progress->shouldCheck(i + 1) && progress->pending()) {
+            progress->snapshot(*machine);
+        }
+    }
+    observer.end(*machine);
+}
+
 #endif // MT_SIMULATOR_H
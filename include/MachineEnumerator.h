@@ -0,0 +1,116 @@
+#ifndef MACHINE_ENUMERATOR_H
+#define MACHINE_ENUMERATOR_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+/**
+ * Máquina monocinta compacta generada por el enumerador
+ *
+ * Tablas planas estado x símbolo; los estados son 0..n-1 y el símbolo 0 es
+ * el blanco. Una transición puede estar sin definir (la enumeración aún no
+ * ha llegado a ella) o parar.
+ */
+struct EnumeratedMachine {
+    static constexpr uint8_t UNDEFINED = 0xFF;
+    static constexpr uint8_t HALT = 0xFE;
+
+    int states;
+    int symbols;
+    std::vector<uint8_t> write;
+    std::vector<uint8_t> move;      // 1 derecha, 0 izquierda
+    std::vector<uint8_t> next;      // Estado siguiente, HALT o UNDEFINED
+
+    EnumeratedMachine() : states(0), symbols(0) {}
+    EnumeratedMachine(int stateCount, int symbolCount);
+
+    /**
+     * Notación estándar: "1RB1LB_1LA1RZ" (Z = parar, --- = sin definir)
+     */
+    std::string toString() const;
+
+    /**
+     * Especificación en el formato de archivo de MTParser
+     * Estados q0..q{n-1} y qH (aceptación = parada); símbolos 0..m-1, blanco 0
+     */
+    std::string toMachineFile() const;
+};
+
+/**
+ * Una máquina que para, con su número de pasos y de símbolos no blancos
+ */
+struct EnumerationResult {
+    EnumeratedMachine machine;
+    long long steps;
+    long long nonBlank;
+
+    EnumerationResult() : steps(0), nonBlank(0) {}
+};
+
+/**
+ * Parámetros de la búsqueda
+ */
+struct EnumerationOptions {
+    int states;
+    int symbols;
+    long long maxSteps;         // Pasos antes de declarar la máquina indecisa
+    int threads;                // 0 = los núcleos disponibles
+    size_t top;                 // Máquinas más largas que se conservan
+
+    EnumerationOptions() : states(2), symbols(2), maxSteps(1000), threads(0), top(10) {}
+};
+
+/**
+ * Recuento de una búsqueda
+ */
+struct EnumerationSummary {
+    long long machines;         // Máquinas clasificadas (hojas del árbol)
+    long long halted;
+    long long cycled;           // Repiten exactamente una configuración
+    long long undecided;        // Superan el límite de pasos o salen de la cinta
+    std::vector<EnumerationResult> longest;    // Por pasos, de mayor a menor
+    double seconds;
+
+    EnumerationSummary() : machines(0), halted(0), cycled(0), undecided(0), seconds(0.0) {}
+};
+
+/**
+ * Enumerador exhaustivo de máquinas de n estados y m símbolos (estilo castor afanoso)
+ *
+ * Usa la forma normal en árbol: cada candidata se ejecuta sobre la cinta en
+ * blanco y solo cuando llega a una transición sin definir se ramifica con las
+ * opciones posibles. Los estados y símbolos que aún no han aparecido son
+ * intercambiables, así que solo se prueba el primero nuevo de cada tipo, y el
+ * primer movimiento es siempre a la derecha (la simetría izquierda/derecha).
+ * Así no se generan transiciones que nunca se usan ni máquinas equivalentes
+ * por renombrado. Cada rama continúa la ejecución del padre en lugar de
+ * empezar de nuevo, y los subárboles se reparten entre hilos.
+ */
+class MachineEnumerator {
+public:
+    // Límite de estados y símbolos (notación de una letra y símbolos de un carácter)
+    static constexpr int MAX_STATES = 25;
+    static constexpr int MAX_SYMBOLS = 10;
+
+    using HaltHandler = std::function<void(const EnumerationResult&)>;
+
+private:
+    EnumerationOptions options;
+
+public:
+    /**
+     * Constructor de MachineEnumerator
+     * Lanza MTException si los parámetros no son válidos
+     */
+    explicit MachineEnumerator(const EnumerationOptions& opts);
+
+    /**
+     * Recorre todo el árbol
+     * @param onHalt Se llama con cada máquina que para (desde un solo hilo a la vez)
+     */
+    EnumerationSummary run(const HaltHandler& onHalt = HaltHandler()) const;
+};
+
+#endif // MACHINE_ENUMERATOR_H
@@ -0,0 +1,45 @@
+#ifndef MACHINE_PROGRAM_H
+#define MACHINE_PROGRAM_H
+
+#include <memory>
+#include <string>
+#include "TuringMachine.h"
+
+class TransitionTable;
+
+/**
+ * Programa inmutable de una máquina, compartible entre hilos
+ *
+ * Guarda una copia privada de la definición de la máquina y su función de
+ * transición ya compilada. Después de construirse no cambia nada: no hay
+ * compilación perezosa ni cachés, así que cualquier número de hilos puede
+ * ejecutar el mismo programa a la vez con su propio ExecutionContext. La
+ * máquina original puede modificarse o destruirse sin afectarle.
+ */
+class MachineProgram {
+private:
+    TuringMachine definition;           // Copia privada: nunca se ejecuta ni se modifica
+    const TransitionTable* table;       // Compilada de definition en el constructor
+
+    explicit MachineProgram(const TuringMachine& tm);
+
+public:
+    MachineProgram(const MachineProgram&) = delete;
+    MachineProgram& operator=(const MachineProgram&) = delete;
+
+    /**
+     * Compila la máquina en un programa que se comparte con shared_ptr
+     */
+    static std::shared_ptr<const MachineProgram> compile(const TuringMachine& tm);
+
+    const TransitionTable& getTable() const { return *table; }
+    const Alphabet& getTapeAlphabet() const { return definition.getTapeAlphabet(); }
+    int getNumberOfTapes() const { return definition.getNumberOfTapes(); }
+
+    /**
+     * Definición de la máquina (solo lectura)
+     */
+    const TuringMachine& getDefinition() const { return definition; }
+};
+
+#endif // MACHINE_PROGRAM_H
@@ -0,0 +1,67 @@
+#ifndef PAGE_ARENA_H
+#define PAGE_ARENA_H
+
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Reserva de páginas de cinta compartida
+ *
+ * Las páginas se reservan en bloques contiguos y se reutilizan al liberarse,
+ * de modo que las cintas de una misma máquina comparten un único espacio de
+ * memoria y el bucle de ejecución no llama al reservador del sistema. También
+ * guarda una página de solo lectura por código de blanco, a la que apunta el
+ * cabezal cuando está sobre una página que nunca se ha escrito.
+ */
+class PageArena {
+private:
+    size_t pageSize;
+    std::vector<uint8_t*> blocks;                 // Bloques reservados (varias páginas cada uno)
+    std::vector<uint8_t*> freePages;              // Páginas disponibles
+    std::array<uint8_t*, 256> blankPages;         // Página en blanco por código (creada al pedirla)
+
+public:
+    /**
+     * Constructor de PageArena
+     * @param pageBytes Tamaño de cada página
+     */
+    explicit PageArena(size_t pageBytes);
+
+    /**
+     * Libera todos los bloques
+     */
+    ~PageArena();
+
+    PageArena(const PageArena&) = delete;
+    PageArena& operator=(const PageArena&) = delete;
+
+    /**
+     * Entrega una página (contenido sin inicializar)
+     */
+    uint8_t* allocate();
+
+    /**
+     * Devuelve una página para reutilizarla
+     */
+    void release(uint8_t* page);
+
+    /**
+     * Página de solo lectura rellena con el código de blanco indicado
+     */
+    const uint8_t* blankPage(uint8_t blankCode);
+
+    /**
+     * Páginas reservadas en total (en uso o libres)
+     */
+    size_t getReservedPages() const;
+
+private:
+    /**
+     * Reserva un bloque nuevo y añade sus páginas a las libres
+     */
+    void grow();
+};
+
+#endif // PAGE_ARENA_H
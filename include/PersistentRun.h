@@ -0,0 +1,74 @@
+#ifndef PERSISTENT_RUN_H
+#define PERSISTENT_RUN_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "PersistentTape.h"
+
+class TuringMachine;
+class TransitionTable;
+class Alphabet;
+
+/**
+ * Configuración de una ejecución sobre cintas persistentes
+ *
+ * Avanza con la función de transición compilada de la máquina, igual que
+ * TuringMachine::executeStep(), pero sus cintas son PersistentTape: copiar
+ * una PersistentRun es una instantánea O(1) de la configuración completa
+ * (estado, cabezales y cintas), y la copia puede seguir ejecutándose por su
+ * cuenta. No aplica el presupuesto de recursos ni el volcado a disco.
+ *
+ * Guarda punteros a la tabla compilada y al alfabeto de la máquina: no debe
+ * modificarse ni destruirse la máquina mientras se usen sus configuraciones.
+ */
+class PersistentRun {
+private:
+    const TransitionTable* program;
+    const Alphabet* alphabet;
+    std::vector<PersistentTape> tapes;
+    std::vector<uint8_t> readBuffer;
+    int stateId;
+    long long stepCount;
+    bool halted;
+    bool accepted;
+
+public:
+    /**
+     * Configuración inicial de tm con la entrada en la primera cinta
+     */
+    PersistentRun(TuringMachine& tm, const std::string& input);
+
+    /**
+     * Aplica una transición
+     * @return false si no hay transición (la máquina se detiene) o ya estaba detenida
+     */
+    bool step();
+
+    /**
+     * Avanza hasta detenerse o dar maxSteps pasos
+     * @return Pasos dados
+     */
+    long long run(long long maxSteps);
+
+    long long getStepCount() const { return stepCount; }
+    bool isHalted() const { return halted; }
+    bool wasAccepted() const { return accepted; }
+    int getNumberOfTapes() const { return static_cast<int>(tapes.size()); }
+    const PersistentTape& getTape(int index) const { return tapes[index]; }
+    const std::string& getStateName() const;
+    std::string getTapeContent(int index) const;
+
+    /**
+     * Misma representación que TuringMachine::getConfiguration() con la cinta completa
+     */
+    std::string getConfiguration() const;
+
+    /**
+     * Trozos de cinta distintos que ocupan en total las configuraciones dadas
+     * (los compartidos se cuentan una vez)
+     */
+    static size_t countChunks(const std::vector<PersistentRun>& runs);
+};
+
+#endif // PERSISTENT_RUN_H
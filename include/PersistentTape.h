@@ -0,0 +1,122 @@
+#ifndef PERSISTENT_TAPE_H
+#define PERSISTENT_TAPE_H
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <unordered_set>
+#include <cstdint>
+#include <cstddef>
+
+class Alphabet;
+
+/**
+ * Cinta persistente con estructura compartida
+ *
+ * Las celdas se guardan en trozos de CHUNK_SIZE códigos colgados de un árbol
+ * de FANOUT hijos por nodo (uno para las posiciones >= 0 y otro para las
+ * negativas). Copiar la cinta es O(1): la copia comparte todo el árbol. Una
+ * escritura sobre un trozo compartido copia solo ese trozo y el camino hasta
+ * la raíz (O(profundidad)); mientras el trozo del cabezal no se comparte, se
+ * escribe en su sitio. Así se pueden guardar muchas configuraciones o bifurcar
+ * ejecuciones pagando solo por las celdas que cambian entre ellas.
+ *
+ * Las copias pueden usarse desde hilos distintos, pero una misma cinta no.
+ */
+class PersistentTape {
+public:
+    static constexpr size_t CHUNK_SIZE = 256;
+    static constexpr int FANOUT_BITS = 5;
+    static constexpr size_t FANOUT = size_t(1) << FANOUT_BITS;
+
+private:
+    /**
+     * Nodo del árbol: interior (children) u hoja (cells)
+     */
+    struct Node {
+        std::vector<std::shared_ptr<Node>> children;
+        std::vector<uint8_t> cells;
+    };
+    using NodePtr = std::shared_ptr<Node>;
+
+    /**
+     * Árbol de una mitad de la cinta: cubre CHUNK_SIZE * FANOUT^depth celdas
+     */
+    struct Side {
+        NodePtr root;
+        int depth;
+    };
+
+    Side right;                     // Posiciones 0, 1, 2...
+    Side left;                      // Posiciones -1, -2, -3... (índice -p - 1)
+    uint8_t blankCode;
+    long long head;
+    long long leftEdge;             // Extensión alcanzada [leftEdge, rightEdge)
+    long long rightEdge;
+
+    // Trozo del cabezal cuando no está compartido (se invalida al copiar)
+    mutable uint8_t* writable;
+    mutable long long writableChunk;        // Índice de trozo con signo (negativo a la izquierda)
+
+public:
+    /**
+     * Cinta con los códigos de content a partir de la posición 0
+     */
+    PersistentTape(const std::string& content, uint8_t blank);
+
+    /**
+     * Copia O(1): ambas cintas comparten los trozos hasta que se escriben
+     */
+    PersistentTape(const PersistentTape& other);
+    PersistentTape& operator=(const PersistentTape& other);
+
+    uint8_t read() const { return readAt(head); }
+    uint8_t readAt(long long position) const;
+
+    /**
+     * Escribe en la celda del cabezal, copiando el trozo si está compartido
+     */
+    void write(uint8_t code);
+
+    /**
+     * Mueve el cabezal (-1 izquierda, 0 quieto, +1 derecha)
+     */
+    void move(int8_t delta);
+
+    /**
+     * Índice del cabezal respecto a la celda más a la izquierda alcanzada (como Tape)
+     */
+    long long getHeadPosition() const { return head - leftEdge; }
+    uint8_t getBlankCode() const { return blankCode; }
+
+    /**
+     * Contenido desde el primer hasta el último símbolo no blanco (como Tape::getVisibleContent)
+     */
+    std::string getVisibleContent(const Alphabet& alphabet) const;
+
+    /**
+     * Añade los trozos de esta cinta a seen y devuelve cuántos eran nuevos
+     * Permite medir la memoria real de un conjunto de copias
+     */
+    size_t collectChunks(std::unordered_set<const void*>& seen) const;
+
+private:
+    /**
+     * Trozo de solo lectura que contiene la posición (nullptr = todo blanco)
+     */
+    const uint8_t* findChunk(long long position) const;
+
+    /**
+     * Trozo propio (sin compartir) que contiene la posición, creándolo o copiándolo
+     */
+    uint8_t* ownChunk(long long position);
+
+    static long long chunkOf(long long position) {
+        return position >= 0 ? position / static_cast<long long>(CHUNK_SIZE)
+                             : -((-position - 1) / static_cast<long long>(CHUNK_SIZE)) - 1;
+    }
+
+    static size_t collectNode(const Node* node, std::unordered_set<const void*>& seen);
+};
+
+#endif // PERSISTENT_TAPE_H
@@ -0,0 +1,87 @@
+#ifndef PROGRESS_MONITOR_H
+#define PROGRESS_MONITOR_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+class TuringMachine;
+
+/**
+ * Instantáneas periódicas del progreso de una ejecución larga
+ *
+ * Un hilo temporizador (y la señal SIGUSR1 donde existe) solo activa un
+ * indicador; el bucle de ejecución lo consulta cada CHECK_INTERVAL pasos y
+ * escribe la instantánea, así que el coste por paso es una máscara y una
+ * comparación.
+ */
+class ProgressMonitor {
+public:
+    // Pasos entre consultas del indicador (potencia de 2)
+    static constexpr long long CHECK_INTERVAL = 1 << 16;
+
+private:
+    std::atomic<bool> requested;
+    double intervalSeconds;
+    std::ofstream file;
+    std::ostream* out;
+
+    std::thread timer;
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    bool stopping;
+
+    std::chrono::steady_clock::time_point runStart;
+    std::chrono::steady_clock::time_point lastSnapshot;
+    long long lastStep;
+
+public:
+    /**
+     * Constructor de ProgressMonitor
+     * @param destination Archivo de salida ("-" para la salida de error)
+     * @param interval Segundos entre instantáneas (0 = solo bajo señal)
+     */
+    ProgressMonitor(const std::string& destination, double interval);
+
+    /**
+     * Detiene el temporizador
+     */
+    ~ProgressMonitor();
+
+    ProgressMonitor(const ProgressMonitor&) = delete;
+    ProgressMonitor& operator=(const ProgressMonitor&) = delete;
+
+    /**
+     * Marca el comienzo de una ejecución
+     */
+    void beginRun();
+
+    /**
+     * Comprueba en el bucle de ejecución si toca escribir una instantánea
+     */
+    bool shouldCheck(long long step) const {
+        return (step & (CHECK_INTERVAL - 1)) == 0;
+    }
+
+    /**
+     * Indica si se ha pedido una instantánea (temporizador o señal)
+     */
+    bool pending() const;
+
+    /**
+     * Escribe una instantánea en JSON: paso, estado, extensión de las cintas y ritmo
+     */
+    void snapshot(const TuringMachine& tm);
+
+private:
+    /**
+     * Bucle del hilo temporizador
+     */
+    void timerLoop();
+};
+
+#endif // PROGRESS_MONITOR_H
@@ -0,0 +1,125 @@
+#ifndef RESOURCE_GOVERNOR_H
+#define RESOURCE_GOVERNOR_H
+
+#include <atomic>
+
+/**
+ * Límites de recursos de una ejecución (0 = sin límite)
+ */
+struct ResourceLimits {
+    long long maxSteps;       // Pasos ejecutados
+    long long maxTapeCells;   // Celdas alcanzadas por cada cinta
+    long long maxBytes;       // Bytes de páginas de cinta en memoria
+
+    ResourceLimits() : maxSteps(0), maxTapeCells(0), maxBytes(0) {}
+};
+
+/**
+ * Presupuesto global del proceso, compartido por todas las ejecuciones
+ */
+class ResourceGovernor {
+private:
+    std::atomic<long long> maxBytes;     // 0 = sin límite
+    std::atomic<long long> bytesInUse;
+
+    ResourceGovernor();
+
+public:
+    /**
+     * Instancia única del proceso
+     */
+    static ResourceGovernor& process();
+
+    /**
+     * Establece el límite global de memoria
+     */
+    void setMaxBytes(long long bytes);
+    long long getMaxBytes() const;
+    long long getBytesInUse() const;
+
+    /**
+     * Reserva bytes del presupuesto global
+     * @return false si no quedan suficientes
+     */
+    bool tryReserve(long long bytes);
+
+    /**
+     * Devuelve bytes al presupuesto global
+     */
+    void release(long long bytes);
+
+    /**
+     * Reparte el presupuesto global de memoria entre ejecuciones concurrentes
+     * @return Límites por ejecución con maxBytes no mayor que la parte de cada una
+     */
+    ResourceLimits share(const ResourceLimits& perRun, int concurrentRuns) const;
+};
+
+/**
+ * Contabilidad de recursos de una ejecución
+ * Las cintas la consultan solo al crecer (páginas nuevas o extremos nuevos)
+ */
+class ResourceBudget {
+private:
+    ResourceLimits limits;
+    long long bytesInUse;
+    long long peakBytes;
+    ResourceGovernor* governor;
+
+public:
+    /**
+     * Constructor de ResourceBudget
+     */
+    explicit ResourceBudget(const ResourceLimits& runLimits = ResourceLimits(),
+                            ResourceGovernor* processGovernor = &ResourceGovernor::process());
+
+    ~ResourceBudget();
+
+    ResourceBudget(const ResourceBudget&) = delete;
+    ResourceBudget& operator=(const ResourceBudget&) = delete;
+
+    /**
+     * Cambia los límites de la ejecución
+     */
+    void setLimits(const ResourceLimits& runLimits);
+    const ResourceLimits& getLimits() const;
+
+    /**
+     * Carga bytes a la ejecución y al proceso
+     * Lanza ResourceLimitException si se supera alguno de los dos límites
+     */
+    void chargeBytes(long long bytes);
+
+    /**
+     * Devuelve bytes previamente cargados
+     */
+    void releaseBytes(long long bytes);
+
+    /**
+     * Comprueba la extensión de una cinta
+     * Lanza ResourceLimitException si supera el máximo de celdas
+     */
+    void checkTapeCells(long long cells) const {
+        if (limits.maxTapeCells > 0 && cells > limits.maxTapeCells) {
+            throwTapeCells(cells);
+        }
+    }
+
+    long long getBytesInUse() const;
+    long long getPeakBytes() const;
+
+    /**
+     * true si no hay límite de celdas ni de memoria, propio ni del proceso
+     */
+    bool isUnlimited() const;
+
+    /**
+     * Reinicia el pico de memoria (al empezar una ejecución)
+     */
+    void resetPeak();
+
+private:
+    [[noreturn]] void throwTapeCells(long long cells) const;
+};
+
+#endif // RESOURCE_GOVERNOR_H
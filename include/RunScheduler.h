@@ -0,0 +1,156 @@
+#ifndef RUN_SCHEDULER_H
+#define RUN_SCHEDULER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class ExecutionContext;
+
+/**
+ * Orden en que se reparten las porciones entre ejecuciones de la misma prioridad
+ */
+enum class SchedulingPolicy {
+    ShortestRemaining,   // Menor presupuesto de pasos primero y, a igual presupuesto, menos porciones
+                         // recibidas (lo ya ejecutado no da ventaja: las nuevas no esperan a las largas)
+    FairShare            // Menos pasos ejecutados hasta ahora primero
+};
+
+/**
+ * Resultado de una ejecución planificada
+ */
+struct ScheduledResult {
+    bool accepted;
+    bool halted;
+    bool cancelled;
+    bool limitExceeded;
+    std::string limitReason;
+    std::string divergence;      // Ciclo encontrado (vacío si no se demostró que diverge)
+    long long steps;
+    std::string finalState;
+    std::vector<std::string> tapes;      // Contenido final de cada cinta
+    long long headPosition;
+    long long slices;            // Porciones que necesitó la ejecución
+
+    ScheduledResult()
+        : accepted(false), halted(false), cancelled(false), limitExceeded(false), steps(0),
+          headPosition(0), slices(0) {}
+};
+
+/**
+ * Planificador de muchas ejecuciones concurrentes sobre un grupo fijo de hilos
+ *
+ * Cada ejecución avanza por porciones de sliceSteps pasos; al terminar una
+ * porción vuelve a la cola y el hilo elige la siguiente por prioridad y, a
+ * igual prioridad, según la política. Así una ejecución corta no espera a que
+ * terminen las largas que ya estaban en marcha.
+ */
+class RunScheduler {
+private:
+    struct Job {
+        ExecutionContext* context;       // Propiedad de la tarea
+        std::string input;
+        long long maxSteps;
+        int priority;
+        long long sequence;              // Orden de llegada (desempate)
+        bool started;
+        std::atomic<bool> cancelRequested;
+        long long slices;
+        std::promise<ScheduledResult> promise;
+
+        Job() : context(nullptr), maxSteps(0), priority(0), sequence(0), started(false),
+                cancelRequested(false), slices(0) {}
+        ~Job();
+    };
+
+public:
+    /**
+     * Referencia a una ejecución enviada: su futuro y su cancelación
+     */
+    class Handle {
+    private:
+        std::shared_ptr<Job> job;
+        std::shared_future<ScheduledResult> future;
+
+    public:
+        Handle() {}
+        Handle(std::shared_ptr<Job> submitted, std::shared_future<ScheduledResult> result)
+            : job(std::move(submitted)), future(std::move(result)) {}
+
+        /**
+         * Pide detener la ejecución al final de su porción actual
+         */
+        void cancel() const;
+
+        /**
+         * Espera al resultado
+         */
+        const ScheduledResult& get() const { return future.get(); }
+
+        std::shared_future<ScheduledResult> getFuture() const { return future; }
+    };
+
+private:
+    long long sliceSteps;
+    SchedulingPolicy policy;
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::vector<std::shared_ptr<Job>> ready;
+    long long submitted;
+    bool stopping;
+
+public:
+    /**
+     * Constructor de RunScheduler
+     * @param workerCount Hilos del grupo (0 = los núcleos disponibles)
+     * @param sliceSteps Pasos por porción
+     */
+    RunScheduler(int workerCount, long long sliceSteps, SchedulingPolicy policy = SchedulingPolicy::ShortestRemaining);
+
+    /**
+     * Cancela las ejecuciones pendientes y espera a los hilos
+     */
+    ~RunScheduler();
+
+    RunScheduler(const RunScheduler&) = delete;
+    RunScheduler& operator=(const RunScheduler&) = delete;
+
+    /**
+     * Envía una ejecución; el planificador pasa a ser propietario del contexto
+     * Los contextos pueden compartir el mismo MachineProgram
+     * @param priority Las prioridades mayores se atienden antes
+     */
+    Handle submit(ExecutionContext* context, const std::string& input, long long maxSteps, int priority = 0);
+
+    int getWorkerCount() const { return static_cast<int>(workers.size()); }
+
+private:
+    /**
+     * Bucle de cada hilo del grupo
+     */
+    void workerLoop();
+
+    /**
+     * Saca de la cola la siguiente tarea según prioridad y política
+     */
+    std::shared_ptr<Job> takeNext();
+
+    /**
+     * Ejecuta una porción; true si la ejecución terminó
+     */
+    bool runSlice(Job& job);
+
+    /**
+     * Cumple el futuro de una tarea terminada
+     */
+    static void complete(Job& job);
+};
+
+#endif // RUN_SCHEDULER_H
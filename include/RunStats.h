@@ -0,0 +1,57 @@
+#ifndef RUN_STATS_H
+#define RUN_STATS_H
+
+#include <string>
+#include <vector>
+
+class TuringMachine;
+
+/**
+ * Estadísticas de una ejecución en formato legible por máquina (JSON)
+ */
+struct RunStats {
+    /**
+     * Estadísticas de una cinta al terminar
+     */
+    struct TapeStats {
+        long long cellsReached;      // Extensión máxima alcanzada
+        long long headPosition;      // Posición final del cabezal
+        long long nonBlankFirst;     // Primer símbolo no-blanco (-1 si está en blanco)
+        long long nonBlankLast;      // Último símbolo no-blanco (-1 si está en blanco)
+        long long pagesAllocated;    // Páginas creadas (en memoria o volcadas)
+        long long cellsAllocated;    // Celdas que ocupan esas páginas
+    };
+
+    std::string machineFile;
+    long long inputLength;
+    std::string result;              // "accept", "reject", "limit" o "diverge"
+    std::string limitReason;
+    std::string divergence;          // Ciclo encontrado si result es "diverge"
+    long long steps;
+    std::string finalState;
+    double loadTimeMs;               // Carga y validación del archivo de la MT
+    double wallTimeMs;               // Ejecución
+    double stepsPerSecond;
+    long long transitionLookups;
+    long long peakMemoryBytes;       // Pico de memoria de páginas de cinta
+    std::vector<TapeStats> tapes;
+
+    RunStats();
+
+    /**
+     * Rellena los datos de la máquina tras una ejecución
+     */
+    void collect(const TuringMachine& tm);
+
+    /**
+     * Serializa en una línea JSON
+     */
+    std::string toJson() const;
+
+    /**
+     * Escapa una cadena para incluirla en JSON (con comillas)
+     */
+    static std::string quote(const std::string& text);
+};
+
+#endif // RUN_STATS_H
@@ -0,0 +1,82 @@
+#ifndef SIMD_KERNELS_H
+#define SIMD_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Conjunto de bytes (256 entradas) preparado para consultas vectorizadas
+ * Se usa como tabla de clases de símbolo al validar cadenas
+ */
+struct ByteSet {
+    uint8_t member[256];     // member[b] = 1 si b pertenece al conjunto
+    uint8_t lowNibble0[16];  // Bit h activo si (h << 4 | lo) ∈ conjunto, h = 0..7
+    uint8_t lowNibble1[16];  // Bit h-8 activo si (h << 4 | lo) ∈ conjunto, h = 8..15
+
+    /**
+     * Crea un conjunto vacío
+     */
+    ByteSet();
+
+    /**
+     * Añade un byte al conjunto
+     */
+    void insert(uint8_t value);
+
+    /**
+     * Vacía el conjunto
+     */
+    void clear();
+
+    /**
+     * Verifica si un byte pertenece al conjunto
+     */
+    bool contains(uint8_t value) const { return member[value] != 0; }
+};
+
+/**
+ * Núcleos de recorrido de buffers de bytes (cinta empaquetada y entrada) y
+ * de consulta de tablas para el motor por lanes
+ *
+ * Cada operación tiene versión AVX2, SSE2/SSSE3 y escalar; la variante se
+ * elige una sola vez en tiempo de ejecución según la CPU.
+ */
+class SimdKernels {
+public:
+    /**
+     * Índice del primer byte distinto de value (length si todos son iguales)
+     */
+    static size_t findFirstNotEqual(const uint8_t* data, size_t length, uint8_t value);
+
+    /**
+     * Índice del último byte distinto de value (length si todos son iguales)
+     */
+    static size_t findLastNotEqual(const uint8_t* data, size_t length, uint8_t value);
+
+    /**
+     * Verifica si todos los bytes pertenecen al conjunto
+     */
+    static bool allInSet(const uint8_t* data, size_t length, const ByteSet& set);
+
+    /**
+     * Índice del primer byte que no pertenece al conjunto (length si todos pertenecen)
+     */
+    static size_t findFirstNotInSet(const uint8_t* data, size_t length, const ByteSet& set);
+
+    /**
+     * Índice del último byte que no pertenece al conjunto (length si todos pertenecen)
+     */
+    static size_t findLastNotInSet(const uint8_t* data, size_t length, const ByteSet& set);
+
+    /**
+     * out[i] = table[indices[i]] para i < count (gather de 8 lanes con AVX2)
+     */
+    static void gather32(const int32_t* table, const int32_t* indices, int32_t* out, size_t count);
+
+    /**
+     * Nombre de la variante seleccionada ("avx2", "sse2" o "scalar")
+     */
+    static const char* activeVariant();
+};
+
+#endif // SIMD_KERNELS_H
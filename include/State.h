@@ -29,7 +29,7 @@ public:
     State(const std::string& stateName, bool initial, bool acceptance);
 
     // Getters
-    std::string getName() const;
+    const std::string& getName() const;
     bool isInitialState() const;
     bool isAcceptanceState() const;
 
@@ -0,0 +1,67 @@
+#ifndef SYMBOL_PATTERN_H
+#define SYMBOL_PATTERN_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include "Alphabet.h"
+
+class Transition;
+
+/**
+ * Campo de símbolo de una transición con comodines
+ *
+ * En los campos de lectura y escritura de una transición se admiten, siempre
+ * que el texto no sea un símbolo de Γ (los símbolos de Γ se toman siempre al pie
+ * de la letra):
+ *   *        lectura: cualquier símbolo; escritura: el símbolo leído en esa cinta
+ *   @nombre  una clase de símbolos declarada con una línea "@nombre s1 s2 ...";
+ *            en escritura, el símbolo de la misma posición en la clase que se
+ *            leyó en esa cinta (ambas clases del mismo tamaño)
+ *   $k       el símbolo leído en la cinta k (en lectura, solo cintas anteriores)
+ *
+ * Una transición con algún campo así es un patrón: TransitionTable la expande
+ * al compilar en las combinaciones que no cubre una transición explícita o un
+ * patrón de mayor precedencia (véase precedes()).
+ */
+struct SymbolPattern {
+    using ClassMap = std::map<std::string, std::vector<std::string>>;
+
+    enum class Kind {
+        Exact,      // symbol
+        Any,        // Cualquier símbolo de Γ
+        Class,      // Los de members (nullptr si la clase no existe)
+        Tape        // El leído en la cinta tape
+    };
+
+    Kind kind;
+    std::string symbol;
+    const std::vector<std::string>* members;
+    int tape;
+
+    /**
+     * true si el campo es un comodín, una clase o una referencia y no un símbolo de Γ
+     */
+    static bool isPattern(const std::string& field, const Alphabet& gamma);
+
+    /**
+     * Interpreta un campo de la cinta tapeIndex (desde 0)
+     * @param write Campo de escritura ('*' es entonces el símbolo leído en esa cinta)
+     */
+    static SymbolPattern parse(const std::string& field, bool write, int tapeIndex, const Alphabet& gamma,
+                               const ClassMap& classes);
+
+    /**
+     * true si algún campo de lectura o escritura de la transición es un patrón
+     */
+    static bool isPattern(const Transition& transition, const Alphabet& gamma);
+
+    /**
+     * Orden de precedencia entre patrones que leen la misma combinación: gana
+     * el que tiene más campos de lectura exactos, después el que tiene menos
+     * '*' y, a igualdad, el que se definió antes
+     */
+    static bool precedes(const Transition& a, const Transition& b, const Alphabet& gamma);
+};
+
+#endif // SYMBOL_PATTERN_H
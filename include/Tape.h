@@ -1,41 +1,140 @@
 #ifndef TAPE_H
 #define TAPE_H
 
-#include <deque>
+#include <vector>
+#include <list>
 #include <string>
+#include <cstdint>
 #include "Alphabet.h"
 
+class TapeSpill;
+class ResourceBudget;
+class PageArena;
+class InputSource;
+
+/**
+ * Estado del cabezal que se consulta en cada paso
+ *
+ * Ocupa una línea de caché. Una cinta suelta guarda el suyo; las cintas de un
+ * TapeBank apuntan a un array contiguo del banco, de modo que leer las k
+ * cintas de una máquina multicinta recorre memoria consecutiva.
+ */
+struct alignas(64) TapeCursor {
+    long long head;                 // Posición absoluta (la entrada empieza en 0)
+    long long page;                 // Página bajo el cabezal
+    const uint8_t* pageRead;        // Datos de esa página (página en blanco compartida si no existe)
+    uint8_t* pageWrite;             // nullptr si la página no está en memoria
+    long long leftEdge;             // Celda más a la izquierda alcanzada
+    long long rightEdge;            // Una más allá de la celda más a la derecha alcanzada
+    long long nonBlankFirst;        // Extensión no blanca [first, last] (vacía si first > last)
+    long long nonBlankLast;
+};
+
 /**
  * Representa la cinta de la Máquina de Turing
  * La cinta es infinita (se expande dinámicamente)
+ *
+ * Las celdas se guardan empaquetadas, un byte por celda con el código del
+ * símbolo según el alfabeto de cinta, en páginas de tamaño fijo que se crean
+ * al escribir por primera vez un símbolo no blanco. Las páginas nunca escritas
+ * se leen como blanco y no ocupan memoria, de modo que el consumo sigue a las
+ * celdas escritas y no al recorrido del cabezal. Opcionalmente las páginas
+ * frías se vuelcan a un archivo proyectado en memoria (política LRU).
  */
 class Tape {
+public:
+    static constexpr size_t PAGE_SIZE = 4096;
+
 private:
-    std::deque<std::string> cells;
-    int headPosition;
+    /**
+     * Entrada del directorio de páginas
+     */
+    struct Page {
+        uint8_t* data;                          // Página residente (nullptr si no lo está)
+        long long spillSlot;                    // Hueco en disco (-1 si no está volcada)
+        std::list<long long>::iterator lruPos;  // Posición en la lista LRU si es residente
+    };
+
+    std::vector<Page> directory;    // Páginas [firstPage, firstPage + directory.size())
+    long long firstPage;
     std::string blankSymbol;
+    uint8_t blankCode;
     const Alphabet* tapeAlphabet;  // Referencia al alfabeto de cinta
 
+    // La extensión no blanca se amplía en O(1) al escribir; al borrar un
+    // extremo solo se marca como pendiente y se recalcula, dentro de la
+    // extensión anterior, al consultarla.
+    mutable bool boundsStale;
+
+    // Cabezal (propio o en el array de un TapeBank)
+    TapeCursor ownCursor;
+    TapeCursor* cursor;
+
+    // Reserva de páginas (propia o compartida con las demás cintas del banco)
+    PageArena* arena;
+    bool ownsArena;
+    const uint8_t* blankView;       // Página en blanco de solo lectura de la reserva
+
+    // Volcado a disco (opcional)
+    TapeSpill* spill;
+    size_t maxResidentPages;
+    size_t residentPages;
+    mutable std::list<long long> lru;   // Más reciente al principio
+
+    // Presupuesto de recursos de la ejecución (opcional)
+    ResourceBudget* budget;
+
+    // Entrada que se carga bajo demanda (opcional): las celdas desde streamEnd
+    // se leen del origen cuando el cabezal llega a ellas
+    InputSource* input;
+    long long streamEnd;
+    bool releaseConsumed;           // Liberar las páginas que el cabezal ya no puede volver a leer
+    long long releasedEnd;          // Las celdas anteriores se liberaron con su contenido (0 = ninguna)
+
 public:
     /**
      * Constructor de Tape
      * @param initialContent Contenido inicial de la cinta (cadena de entrada)
      * @param blank Símbolo que representa celdas vacías
      * @param alphabet Alfabeto de cinta (opcional, para validación)
+     * @param runBudget Presupuesto de recursos (opcional): se cargan las páginas
+     *        en memoria y se comprueba la extensión cada vez que la cinta crece
+     * @param sharedCursor Estado del cabezal externo (opcional, lo usa TapeBank)
+     * @param sharedArena Reserva de páginas compartida (opcional, lo usa TapeBank)
      */
-    Tape(const std::string& initialContent, const std::string& blank, 
-         const Alphabet* alphabet = nullptr);
+    Tape(const std::string& initialContent, const std::string& blank,
+         const Alphabet* alphabet = nullptr, ResourceBudget* runBudget = nullptr,
+         TapeCursor* sharedCursor = nullptr, PageArena* sharedArena = nullptr);
+
+    /**
+     * Destructor: libera las páginas (vuelven a la reserva)
+     */
+    ~Tape();
+
+    Tape(const Tape&) = delete;
+    Tape& operator=(const Tape&) = delete;
 
     /**
      * Lee el símbolo en la posición actual del cabezal
      */
-    std::string read() const;
+    const std::string& read() const;
 
     /**
      * Escribe un símbolo en la posición actual del cabezal
      */
     void write(const std::string& symbol);
 
+    /**
+     * Código (según el alfabeto de cinta) de la celda bajo el cabezal
+     */
+    uint8_t readCode() const;
+
+    /**
+     * Escribe un código en la celda bajo el cabezal; no reserva memoria salvo
+     * al crear la página la primera vez que recibe un símbolo no blanco
+     */
+    void writeCode(uint8_t code);
+
     /**
      * Mueve el cabezal a la derecha
      */
@@ -46,10 +145,29 @@ public:
      */
     void moveLeft();
 
+    /**
+     * Página que contiene una posición absoluta
+     */
+    static long long pageOf(long long position) {
+        // División entera hacia -infinito
+        const long long size = static_cast<long long>(PAGE_SIZE);
+        return position >= 0 ? position / size : -((-position - 1) / size) - 1;
+    }
+
+    /**
+     * Código del símbolo blanco
+     */
+    uint8_t getBlankCode() const { return blankCode; }
+
+    /**
+     * Símbolo blanco de la cinta
+     */
+    const std::string& getBlankSymbol() const;
+
     /**
      * Obtiene la posición del cabezal
      */
-    int getHeadPosition() const;
+    long long getHeadPosition() const;
 
     /**
      * Obtiene el contenido actual de la cinta
@@ -61,21 +179,180 @@ public:
      */
     std::string getVisibleContent() const;
 
+    /**
+     * Escribe el contenido visible en un descriptor de archivo sin construirlo en memoria
+     * Con codificación identidad las páginas se envían tal cual (writev); en otro
+     * caso se decodifican por bloques.
+     * @param terminator Texto que se añade al final (en la misma escritura)
+     * @return Bytes escritos
+     */
+    long long writeVisibleContent(int fd, const std::string& terminator = "") const;
+
+    /**
+     * Representa solo las celdas a menos de radius posiciones del cabezal
+     * Los tramos alcanzados que quedan fuera se indican con "…"; el coste es
+     * proporcional a radius y no al tamaño de la cinta.
+     * @param markHead Rodea la celda del cabezal con '|'
+     */
+    std::string getWindow(long long radius, bool markHead) const;
+
+    /**
+     * Obtiene los índices (como getHeadPosition) del primer y último símbolo no-blanco
+     * @return false si la cinta está en blanco
+     */
+    bool getNonBlankBounds(long long& first, long long& last) const;
+
+    /**
+     * Número de celdas alcanzadas por el cabezal o la entrada (extensión máxima)
+     */
+    long long getCellsReached() const;
+
+    /**
+     * Posición absoluta del cabezal y extensión alcanzada [izquierda, derecha)
+     * A diferencia de getHeadPosition(), no cambian al crecer la cinta por la
+     * izquierda; fuera de la extensión todas las celdas son blancas
+     */
+    long long getHeadIndex() const { return cursor->head; }
+    long long getLeftEdge() const { return cursor->leftEdge; }
+    long long getRightEdge() const { return cursor->rightEdge; }
+
+    /**
+     * Copia los códigos de las celdas absolutas [first, last) a out
+     */
+    void copyCodes(long long first, long long last, uint8_t* out) const;
+
+    /**
+     * Celdas consecutivas, como mucho limit, desde la celda absoluta from en la
+     * dirección direction (+1 o -1) cuyos códigos pertenecen al conjunto
+     */
+    long long countRun(long long from, int direction, long long limit, const ByteSet& set) const;
+
+    /**
+     * Escribe count códigos en las celdas absolutas [first, first + count) con
+     * el mismo efecto que escribirlos uno a uno con writeCode(), por páginas
+     */
+    void writeCodes(long long first, const uint8_t* codes, long long count);
+
+    /**
+     * Celdas que el cabezal puede avanzar en una dirección sin leer más de la entrada bajo demanda
+     */
+    long long getLoadedReach(int direction) const;
+
+    /**
+     * Primera celda que conserva su contenido después de liberar la entrada ya
+     * leída (attachInput con releaseBehind); 0 si no se ha liberado ninguna
+     * Las celdas anteriores se leen como blanco: el contenido está truncado
+     */
+    long long getReleasedEnd() const { return releasedEnd; }
+
+    /**
+     * Mueve el cabezal cells celdas (negativo = izquierda) con el mismo efecto
+     * que otras tantas moveRight()/moveLeft(); no pasa de getLoadedReach()
+     */
+    void advanceHead(long long cells);
+
     /**
      * Reinicia la cinta a su estado inicial
      */
     void reset(const std::string& initialContent);
 
+    /**
+     * Carga las celdas tal cual (un carácter por celda) y coloca el cabezal
+     * Se usa para volcar el resultado de los motores rápidos (DFAScanner)
+     */
+    void load(const std::string& cellContent, long long headIndex);
+
+    /**
+     * Vacía la cinta y la llena bajo demanda desde un origen de entrada
+     * Solo se carga la primera página; las siguientes se leen cuando el
+     * cabezal pasa de la parte cargada. La cinta no es propietaria del origen.
+     * @param releaseBehind Libera las páginas a la izquierda del cabezal al
+     *        avanzar (solo válido si la cinta nunca se mueve a la izquierda);
+     *        esas celdas dejan de aparecer en el contenido de la cinta
+     */
+    void attachInput(InputSource* source, bool releaseBehind);
+
     /**
      * Valida si un símbolo es válido para escribir en la cinta
      */
     bool isValidSymbol(const std::string& symbol) const;
 
+    /**
+     * Activa el volcado a disco de páginas frías
+     * @param maxResident Páginas que se mantienen en memoria como máximo
+     * @param directory Directorio donde se crea el archivo temporal
+     */
+    void enableSpill(size_t maxResident, const std::string& directory);
+
+    /**
+     * Número de páginas en memoria
+     */
+    size_t getResidentPages() const;
+
+    /**
+     * Número de páginas creadas (en memoria o en disco)
+     */
+    size_t getAllocatedPages() const;
+
 private:
     /**
-     * Expande la cinta si es necesario
+     * Alfabeto usado para codificar (identidad si no hay alfabeto de cinta)
+     */
+    const Alphabet& codec() const;
+
+    /**
+     * Actualiza la caché de la página bajo el cabezal
+     */
+    void refreshCursor() const;
+
+    /**
+     * Devuelve la página indicada en memoria, creándola si create es true
+     * La página devuelta no se vuelca a disco hasta la siguiente llamada
+     * @return nullptr si la página no existe y no se pide crearla
+     */
+    uint8_t* residentPage(long long page, bool create);
+
+    /**
+     * Datos de una página para solo lectura, residente o volcada (nullptr si es blanca)
+     */
+    const uint8_t* pageView(long long page) const;
+
+    /**
+     * Vuelca a disco la página menos usada si se supera el límite
+     * @param keep Página que el llamador va a usar y no puede volcarse
+     */
+    void enforceResidentLimit(long long keep);
+
+    /**
+     * Libera todas las páginas
+     */
+    void releasePages();
+
+    /**
+     * Libera las páginas anteriores a la indicada
+     */
+    void releasePagesBefore(long long page);
+
+    /**
+     * Lee del origen de entrada el siguiente tramo (hasta el final de su página)
+     */
+    void fillInput();
+
+    /**
+     * Posiciones absolutas del primer y último símbolo no-blanco
+     * Resuelve la extensión pendiente si algún extremo se borró
+     */
+    bool nonBlankExtent(long long& first, long long& last) const;
+
+    /**
+     * Busca el primer y último símbolo no-blanco en [rangeStart, rangeEnd)
+     */
+    bool scanNonBlankBounds(long long rangeStart, long long rangeEnd, long long& first, long long& last) const;
+
+    /**
+     * Decodifica un rango de posiciones absolutas [first, last) a texto
      */
-    void expandIfNeeded();
+    std::string decodeRange(long long first, long long last) const;
 };
 
 #endif // TAPE_H
@@ -0,0 +1,130 @@
+#ifndef TAPE_BANK_H
+#define TAPE_BANK_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "Tape.h"
+#include "PageArena.h"
+
+/**
+ * Conjunto de cintas de una máquina con almacenamiento compartido
+ *
+ * Los cabezales de las k cintas viven en un único array contiguo y las páginas
+ * de todas salen de la misma reserva. El bucle de ejecución lee y escribe a
+ * través de readCodes() y writeAndMove(), que resuelven el caso común (el
+ * cabezal sigue en la página en caché) sin tocar los objetos Tape; los cambios
+ * de página, el crecimiento de la cinta y los presupuestos pasan por Tape.
+ */
+class TapeBank {
+private:
+    int count;
+    TapeCursor* cursors;                    // count cabezales contiguos
+    std::vector<Tape*> tapes;               // nullptr hasta la primera ejecución
+    std::vector<uint8_t> blankCodes;
+    std::vector<const uint8_t*> blankViews; // Página en blanco de cada cinta
+    PageArena arena;
+
+public:
+    /**
+     * Constructor de TapeBank (sin cintas)
+     */
+    TapeBank();
+
+    /**
+     * Destructor: libera las cintas y la reserva
+     */
+    ~TapeBank();
+
+    TapeBank(const TapeBank&) = delete;
+    TapeBank& operator=(const TapeBank&) = delete;
+
+    /**
+     * Cambia el número de cintas (descarta las existentes)
+     */
+    void resize(int n);
+
+    /**
+     * Número de cintas
+     */
+    int size() const { return count; }
+
+    /**
+     * Cinta i (nullptr si aún no se ha creado)
+     */
+    Tape* operator[](int i) const { return tapes[i]; }
+
+    /**
+     * Prepara la cinta i para una ejecución: la reinicia con el contenido
+     * dado o la crea si no existe o cambió el símbolo blanco
+     */
+    void prepare(int i, const std::string& content, const std::string& blank,
+                 const Alphabet* alphabet, ResourceBudget* budget);
+
+    /**
+     * Descarta todas las cintas (se crean de nuevo en prepare())
+     */
+    void clear();
+
+    /**
+     * Cabezal de la cinta i (sin pasar por el objeto Tape)
+     */
+    const TapeCursor& cursor(int i) const { return cursors[i]; }
+
+    /**
+     * Códigos bajo los k cabezales
+     */
+    void readCodes(uint8_t* codes) const {
+        for (int i = 0; i < count; i++) {
+            const TapeCursor& c = cursors[i];
+            unsigned long long offset = static_cast<unsigned long long>(c.head - c.page * PAGE);
+            codes[i] = offset < PAGE ? c.pageRead[offset] : tapes[i]->readCode();
+        }
+    }
+
+    /**
+     * Escribe un código en la cinta i y mueve su cabezal (-1, 0 o +1)
+     */
+    void writeAndMove(int i, uint8_t code, int move) {
+        TapeCursor& c = cursors[i];
+        unsigned long long offset = static_cast<unsigned long long>(c.head - c.page * PAGE);
+        const uint8_t blank = blankCodes[i];
+        if (offset >= PAGE) {
+            tapes[i]->writeCode(code);
+        } else if (c.pageWrite != nullptr && code != blank) {
+            c.pageWrite[offset] = code;
+            if (c.nonBlankFirst > c.nonBlankLast) {
+                c.nonBlankFirst = c.head;
+                c.nonBlankLast = c.head;
+            } else if (c.head < c.nonBlankFirst) {
+                c.nonBlankFirst = c.head;
+            } else if (c.head > c.nonBlankLast) {
+                c.nonBlankLast = c.head;
+            }
+        } else if (c.pageWrite != nullptr && c.head != c.nonBlankFirst && c.head != c.nonBlankLast) {
+            c.pageWrite[offset] = code;
+        } else if (c.pageRead != blankViews[i] || code != blank) {
+            // Página sin crear o volcada, o blanco sobre un extremo: lo resuelve la cinta
+            tapes[i]->writeCode(code);
+        }
+
+        if (move > 0) {
+            if (c.head + 1 < c.rightEdge) {
+                c.head++;
+            } else {
+                tapes[i]->moveRight();
+            }
+        } else if (move < 0) {
+            if (c.head > c.leftEdge) {
+                c.head--;
+            } else {
+                tapes[i]->moveLeft();
+            }
+        }
+    }
+
+private:
+    static constexpr long long PAGE = static_cast<long long>(Tape::PAGE_SIZE);
+};
+
+#endif // TAPE_BANK_H
@@ -0,0 +1,86 @@
+#ifndef TAPE_PRIMITIVES_H
+#define TAPE_PRIMITIVES_H
+
+#include <vector>
+#include <cstdint>
+#include "SimdKernels.h"
+#include "TapeBank.h"
+
+class TransitionTable;
+
+/**
+ * Primitivas nativas de cinta: bucles de un estado sobre sí mismo ejecutados de una vez
+ *
+ * Buena parte de los pasos de una máquina suelen ser bucles conocidos: avanzar
+ * hasta el siguiente blanco, copiar una cinta en otra (mt_copiar.txt) o
+ * comparar dos cintas. Al compilar la tabla se reconocen las transiciones que
+ * inician uno de estos bucles y el bucle entero se ejecuta con recorridos
+ * vectorizados y copias por páginas; los pasos avanzan exactamente lo que
+ * habría dado el motor paso a paso, con la misma cinta, cabezales y estado.
+ *
+ *  - Búsqueda: una cinta avanza sin cambiar lo que lee mientras lee símbolos de un conjunto
+ *  - Copia: dos cintas avanzan; la de origen no cambia y la de destino, que lee
+ *    siempre el mismo símbolo, recibe lo leído en la de origen
+ *  - Comparación: dos cintas avanzan sin cambiar nada mientras leen el mismo símbolo
+ * El resto de cintas no se mueven ni cambian.
+ *
+ * Solo son equivalentes si nada más observa los pasos intermedios: quien las
+ * usa se encarga de no hacerlo con traza, perfil, detección de ciclos, volcado
+ * a disco o límites de celdas y memoria.
+ */
+class TapePrimitives {
+public:
+    enum class Kind {
+        Seek,
+        Copy,
+        Compare
+    };
+
+    /**
+     * Bucle reconocido a partir de una transición
+     */
+    struct Primitive {
+        Kind kind;
+        int source;             // Cinta que se recorre (origen de la copia)
+        int target;             // Destino de la copia o segunda cinta comparada (-1 en la búsqueda)
+        int sourceMove;         // -1 o +1
+        int targetMove;
+        uint8_t targetCode;     // Símbolo que lee el destino de la copia
+        ByteSet codes;          // Símbolos de source con los que el bucle continúa
+    };
+
+    /**
+     * Reconoce el bucle que empieza con la transición index de la tabla
+     * @param symbols Códigos de Γ
+     * @param lookups Búsquedas en la tabla que aún se pueden hacer (se descuentan)
+     * @return false si la transición no inicia ninguna primitiva
+     */
+    static bool detect(const TransitionTable& table, size_t index, const std::vector<uint8_t>& symbols,
+                       long long& lookups, Primitive& result);
+
+    /**
+     * Si la configuración actual (estado y códigos bajo los cabezales) inicia una
+     * primitiva de la tabla, la ejecuta durante como mucho maxSteps pasos
+     * @param codes Búfer de un código por cinta
+     * @param scratch Búfer de bloques del ejecutor (crece una vez y se reutiliza)
+     * @return Pasos ejecutados (0 si no inicia ninguna: el paso se interpreta)
+     */
+    static long long execute(const TransitionTable& table, int state, TapeBank& tapes, uint8_t* codes,
+                             std::vector<uint8_t>& scratch, long long maxSteps);
+
+    /**
+     * Ejecuta la primitiva desde la configuración actual, cuya transición es
+     * la que la inicia, durante como mucho maxSteps pasos
+     * @return Pasos ejecutados
+     */
+    static long long run(const Primitive& primitive, TapeBank& tapes, std::vector<uint8_t>& scratch,
+                         long long maxSteps);
+
+private:
+    /**
+     * Celdas por bloque al copiar o comparar
+     */
+    static constexpr long long BLOCK = 1 << 16;
+};
+
+#endif // TAPE_PRIMITIVES_H
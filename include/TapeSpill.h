@@ -0,0 +1,62 @@
+#ifndef TAPE_SPILL_H
+#define TAPE_SPILL_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Almacén en disco para páginas frías de la cinta
+ *
+ * Las páginas se guardan en un archivo temporal (borrado al crearse) que se
+ * proyecta en memoria por bloques; cada página ocupa un hueco fijo que se
+ * reutiliza al liberarse.
+ */
+class TapeSpill {
+private:
+    int fileDescriptor;
+    size_t pageSize;
+    size_t chunkBytes;                   // Bytes proyectados por bloque
+    std::vector<uint8_t*> chunks;        // Bloques proyectados del archivo
+    std::vector<long long> freeSlots;    // Huecos libres para reutilizar
+    long long slotCount;                 // Huecos creados hasta ahora
+
+public:
+    /**
+     * Crea el archivo temporal en el directorio indicado
+     * Lanza MTException si no se puede crear o la plataforma no lo soporta
+     */
+    TapeSpill(const std::string& directory, size_t pageBytes);
+
+    /**
+     * Libera las proyecciones y cierra el archivo
+     */
+    ~TapeSpill();
+
+    TapeSpill(const TapeSpill&) = delete;
+    TapeSpill& operator=(const TapeSpill&) = delete;
+
+    /**
+     * Copia una página al archivo y devuelve su hueco
+     */
+    long long store(const uint8_t* data);
+
+    /**
+     * Acceso de solo lectura a una página guardada
+     */
+    const uint8_t* view(long long slot) const;
+
+    /**
+     * Libera un hueco para que lo reutilice otra página
+     */
+    void release(long long slot);
+
+private:
+    /**
+     * Amplía el archivo y proyecta un bloque nuevo
+     */
+    void growFile();
+};
+
+#endif // TAPE_SPILL_H
@@ -0,0 +1,139 @@
+#ifndef TRACE_WRITER_H
+#define TRACE_WRITER_H
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cstddef>
+#include "TuringMachine.h"
+
+/**
+ * Formato de cada línea de la traza
+ */
+enum class TraceFormat {
+    Text,       // "Paso n: <configuración>", como la traza clásica
+    Csv,        // ejecucion,paso,estado,cinta,contenido,cabezal (una fila por cinta)
+    Jsonl       // Un objeto JSON por configuración
+};
+
+/**
+ * Escritor de la traza durante la ejecución
+ *
+ * Cada configuración se formatea en un búfer de BUFFER_SIZE bytes que se
+ * vuelca al descriptor solo cuando se llena y al terminar la ejecución: la
+ * memoria no depende de la longitud de la traza y no hay una llamada al
+ * sistema por línea.
+ *
+ * Se escribe la configuración inicial, una de cada stride pasos y la final.
+ * Con una muestra de n configuraciones, de las intermedias se guardan solo n
+ * elegidas uniformemente al azar (muestreo por reservorio, algoritmo L: el
+ * siguiente paso que entra en la muestra se calcula de antemano) y se escriben
+ * en orden al terminar. La semilla es fija, así que la muestra es reproducible.
+ *
+ * El mismo escritor puede recibir varias ejecuciones seguidas; se numeran
+ * desde 1 en CSV y JSONL.
+ */
+class TraceWriter {
+public:
+    static constexpr size_t BUFFER_SIZE = 1 << 20;
+
+private:
+    /**
+     * Configuración guardada en la muestra
+     */
+    struct Sample {
+        long long step;
+        std::string line;
+    };
+
+    int fd;
+    TraceFormat outputFormat;
+    long long stride;
+    size_t sampleSize;          // 0 = sin muestreo
+    std::string buffer;
+
+    int runIndex;
+    bool headerWritten;
+    long long nextStep;         // Siguiente paso que se escribe o entra en la muestra
+    long long lastWritten;      // Último paso escrito (-1 = ninguno)
+
+    std::vector<Sample> samples;
+    std::mt19937_64 random;
+    double weight;              // W del algoritmo L
+
+public:
+    /**
+     * Constructor de TraceWriter
+     * @param fd Descriptor de salida (no se cierra)
+     */
+    TraceWriter(int fd, TraceFormat format);
+
+    /**
+     * Vuelca lo pendiente (sin excepciones)
+     */
+    ~TraceWriter();
+
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    /**
+     * Convierte "text", "csv" o "jsonl" en un formato
+     * @return false si el nombre no es válido
+     */
+    static bool parseFormat(const std::string& name, TraceFormat& result);
+
+    /**
+     * Escribe solo una de cada k configuraciones (por número de paso)
+     */
+    void setStride(long long k);
+
+    /**
+     * Conserva solo n configuraciones intermedias elegidas al azar (0 = todas)
+     */
+    void setSampleSize(size_t n);
+
+    /**
+     * Comienza una ejecución: cabecera y configuración inicial
+     */
+    void begin(const TuringMachine& tm);
+
+    /**
+     * Se llama tras cada paso; solo formatea los pasos que se escriben o entran en la muestra
+     */
+    void record(const TuringMachine& tm) {
+        if (tm.getStepCount() >= nextStep) {
+            take(tm);
+        }
+    }
+
+    /**
+     * Termina la ejecución: muestra, configuración final y volcado
+     */
+    void finish(const TuringMachine& tm);
+
+    /**
+     * Escribe en el descriptor el contenido del búfer
+     */
+    void flush();
+
+private:
+    void take(const TuringMachine& tm);
+
+    /**
+     * Añade a out la configuración actual en el formato del escritor
+     */
+    void format(const TuringMachine& tm, std::string& out) const;
+
+    /**
+     * Paso de la siguiente configuración que entra en la muestra llena (algoritmo L)
+     */
+    long long skipAfter(long long step);
+
+    void flushIfFull() {
+        if (buffer.size() >= BUFFER_SIZE) {
+            flush();
+        }
+    }
+};
+
+#endif // TRACE_WRITER_H
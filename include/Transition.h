@@ -18,6 +18,7 @@ private:
     State nextState;
     std::vector<std::string> writeSymbols;  // Para multicinta (monocinta usa solo [0])
     std::vector<char> directions;           // Para multicinta (monocinta usa solo [0])
+    int id;                                 // Índice de la transición en la máquina (-1 si no asignado)
 
 public:
     /**
@@ -52,6 +53,10 @@ public:
     int getNumTapes() const;
     bool isMultiTape() const;
 
+    // Identificador (asignado por TuringMachine::addTransition)
+    int getId() const;
+    void setId(int transitionId);
+
     // Métodos auxiliares
     std::string toString() const;
 };
@@ -0,0 +1,162 @@
+#ifndef TRANSITION_TABLE_H
+#define TRANSITION_TABLE_H
+
+#include <array>
+#include <functional>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstring>
+#include "State.h"
+#include "Transition.h"
+#include "TapePrimitives.h"
+
+class TuringMachine;
+
+/**
+ * Función de transición compilada para el bucle de ejecución
+ *
+ * Los estados se numeran y los símbolos se sustituyen por sus códigos de cinta,
+ * de modo que un paso no construye cadenas ni copia estados: con una cinta la
+ * búsqueda es un acceso a una tabla plana estado x byte. Con varias cintas los
+ * códigos se numeran de forma densa (solo los símbolos usados) y, si la tabla
+ * estado x símbolo^k cabe, también es un acceso directo; si no, una tabla hash
+ * de direccionamiento abierto sobre (estado, códigos leídos).
+ * Se construye una vez por máquina y no reserva memoria durante la ejecución.
+ */
+class TransitionTable {
+public:
+    /**
+     * Transición compilada
+     */
+    struct Entry {
+        uint64_t key;               // Hasta 8 códigos leídos empaquetados (varias cintas)
+        int32_t state;              // Estado de origen
+        int32_t next;               // Estado siguiente
+        int32_t id;                 // Identificador de la transición (perfilador)
+        uint32_t offset;            // Posición de sus códigos en readCodes/writeCodes/moves
+        bool encodable;             // false si algún símbolo escrito no tiene código
+        int32_t primitive;          // Primitiva nativa que inicia (índice en primitives, -1 = ninguna)
+        const Transition* source;   // Transición original
+    };
+
+private:
+    int tapes;
+    std::vector<State> stateList;            // Estados indexados por id
+    std::unordered_map<std::string, int> stateIds;   // Nombre -> id
+    std::vector<char> accepting;             // accepting[s] != 0 si s ∈ F
+    int initialState;
+
+    std::vector<Entry> entries;
+    std::vector<uint8_t> readCodes;          // tapes códigos por transición
+    std::vector<uint8_t> writeCodes;
+    std::vector<int8_t> moves;               // -1 izquierda, 0 quieto, +1 derecha
+
+    // Acceso directo: índices de entries (-1 = ninguna) por estado y combinación leída
+    std::vector<int32_t> direct;
+    size_t stateStride;                      // Entradas por estado (256 con una cinta, radix^k con varias)
+    size_t radix;                            // Símbolos distintos + 1 (código sin transiciones)
+    std::array<uint16_t, 256> symbolIndex;   // Código -> índice denso
+
+    // Varias cintas con demasiadas combinaciones: tabla hash de índices de entries
+    std::vector<int32_t> slots;
+    size_t slotMask;
+
+    // Bucles reconocidos como primitivas nativas de cinta
+    std::vector<TapePrimitives::Primitive> primitives;
+    std::vector<char> primitiveStates;       // primitiveStates[s] != 0 si alguna transición de s inicia una
+
+    TransitionTable();
+
+public:
+    /**
+     * Compila la función de transición de la máquina
+     */
+    static TransitionTable* compile(const TuringMachine& tm);
+
+    /**
+     * Busca la transición para un estado y los códigos leídos de cada cinta
+     * @return nullptr si no hay transición
+     */
+    const Entry* find(int state, const uint8_t* codes) const {
+        if (tapes == 1) {
+            int32_t index = direct[static_cast<size_t>(state) * 256 + codes[0]];
+            return index < 0 ? nullptr : &entries[index];
+        }
+        if (!direct.empty()) {
+            size_t offset = 0;
+            for (int i = tapes; i-- > 0;) {
+                offset = offset * radix + symbolIndex[codes[i]];
+            }
+            int32_t index = direct[static_cast<size_t>(state) * stateStride + offset];
+            return index < 0 ? nullptr : &entries[index];
+        }
+        const uint64_t key = packCodes(codes);
+        for (size_t slot = hashOf(state, key) & slotMask;; slot = (slot + 1) & slotMask) {
+            int32_t index = slots[slot];
+            if (index < 0) {
+                return nullptr;
+            }
+            const Entry& entry = entries[index];
+            if (entry.key == key && entry.state == state &&
+                (tapes <= 8 || std::memcmp(&readCodes[entry.offset], codes, tapes) == 0)) {
+                return &entry;
+            }
+        }
+    }
+
+    const uint8_t* getReadCodes(const Entry& entry) const { return &readCodes[entry.offset]; }
+    const uint8_t* getWriteCodes(const Entry& entry) const { return &writeCodes[entry.offset]; }
+    const int8_t* getMoves(const Entry& entry) const { return &moves[entry.offset]; }
+    bool isAccepting(int state) const { return accepting[state] != 0; }
+    const State& getState(int state) const { return stateList[state]; }
+    int getInitialState() const { return initialState; }
+    int getTapeCount() const { return tapes; }
+    size_t getEntryCount() const { return entries.size(); }
+    const Entry& getEntry(size_t index) const { return entries[index]; }
+
+    bool startsPrimitive(int state) const { return primitiveStates[state] != 0; }
+    const TapePrimitives::Primitive& getPrimitive(const Entry& entry) const { return primitives[entry.primitive]; }
+
+    /**
+     * Índice de un estado por nombre (-1 si no existe)
+     */
+    int findState(const std::string& name) const;
+
+private:
+    /**
+     * Construye el índice de búsqueda (tabla directa o hash) sobre entries
+     */
+    void buildIndex();
+
+    /**
+     * Reconoce las transiciones que inician una primitiva nativa (TapePrimitives)
+     */
+    void detectPrimitives(const Alphabet& alphabet);
+
+    /**
+     * Añade las combinaciones de un patrón de SymbolPattern que claim(estado, códigos) acepta
+     */
+    void expand(const Transition& pattern, const TuringMachine& tm, int state, int next,
+                const std::function<bool(int, const uint8_t*)>& claim);
+
+    /**
+     * Empaqueta los códigos de las 8 primeras cintas en un entero
+     */
+    uint64_t packCodes(const uint8_t* codes) const {
+        uint64_t key = 0;
+        const int packed = tapes < 8 ? tapes : 8;
+        for (int i = 0; i < packed; i++) {
+            key |= static_cast<uint64_t>(codes[i]) << (8 * i);
+        }
+        return key;
+    }
+
+    static size_t hashOf(int state, uint64_t key) {
+        uint64_t hash = (key ^ (static_cast<uint64_t>(state) << 40)) * 0x9E3779B97F4A7C15ULL;
+        return static_cast<size_t>(hash ^ (hash >> 29));
+    }
+};
+
+#endif // TRANSITION_TABLE_H
@@ -9,6 +9,15 @@
 #include "Alphabet.h"
 #include "Transition.h"
 #include "Tape.h"
+#include "TapeBank.h"
+#include "ResourceGovernor.h"
+#include "ExecutionProfiler.h"
+#include "DivergenceDetector.h"
+
+class InputSource;
+
+class DFAScanner;
+class TransitionTable;
 
 /**
  * Representa una Máquina de Turing completa
@@ -25,13 +34,51 @@ private:
     
     // Función de transición: mapa de (estado, símbolo(s)) -> Transition
     std::map<std::pair<std::string, std::string>, Transition> transitions;
+
+    // Clases de símbolos que pueden usar las transiciones (@nombre), véase SymbolPattern
+    std::map<std::string, std::vector<std::string>> symbolClasses;
     
+    // Función de transición compilada (se invalida al modificar la máquina)
+    TransitionTable* program;
+
     // Estado de ejecución
-    State currentState;
-    std::vector<Tape*> tapes;                  // Cintas (1 o más)
-    int stepCount;
+    State currentState;                        // Estado fuera del bucle compilado
+    int currentStateId;                        // Índice en program (-1 = usar currentState)
+    std::vector<uint8_t> readBuffer;           // Códigos leídos en el paso actual
+    std::vector<uint8_t> primitiveBuffer;      // Bloques de las primitivas nativas (TapePrimitives)
+    TapeBank tapes;                            // Cintas (1 o más)
+    long long stepCount;
+    long long lookupCount;                     // Búsquedas en la tabla de transiciones
     bool isAccepted;
     bool hasHalted;
+    bool limitExceeded;                        // Se detuvo por superar el presupuesto
+    std::string limitReason;
+    bool diverged;                             // Se detuvo al demostrar que no termina
+
+    // Detección de ciclos y ciclos trasladados (opcional)
+    bool divergenceCheck;
+    DivergenceDetector divergence;
+
+    // Presupuesto de recursos de la ejecución
+    ResourceBudget budget;
+
+#ifdef MT_ENABLE_PROFILER
+    // Contadores por transición (solo en compilaciones con perfilador)
+    ExecutionProfiler profiler;
+#endif
+
+    // Versión AFD de la máquina (nullptr si no es reducible)
+    DFAScanner* dfa;
+
+    // Volcado de páginas frías de las cintas a disco (0 = desactivado)
+    size_t spillResidentPages;
+    std::string spillDirectory;
+
+    // Celdas a cada lado del cabezal al representar la cinta (0 = completa)
+    long long tapeWindow;
+
+    // Ejecutar de una vez los bucles reconocidos como primitivas (TapePrimitives)
+    bool nativePrimitives;
 
 public:
     /**
@@ -39,6 +86,13 @@ public:
      */
     TuringMachine();
 
+    /**
+     * Copia la definición (estados, alfabetos, transiciones) y la configuración
+     * (límites, volcado, ventana, detección de ciclos, primitivas), no la ejecución en curso
+     */
+    TuringMachine(const TuringMachine& other);
+    TuringMachine& operator=(const TuringMachine&) = delete;
+
     /**
      * Destructor
      */
@@ -54,44 +108,155 @@ public:
     void addTransition(const Transition& transition);
     void setNumberOfTapes(int n);  // Nuevo: establecer número de cintas
 
+    /**
+     * Define (o redefine) la clase de símbolos @name para las transiciones
+     */
+    void addSymbolClass(const std::string& name, const std::vector<std::string>& symbols);
+    const std::map<std::string, std::vector<std::string>>& getSymbolClasses() const;
+
+    /**
+     * true si alguna transición usa comodines, clases o referencias a otras cintas
+     */
+    bool hasTransitionPatterns() const;
+
+    /**
+     * Intenta compilar la máquina a un AFD (solo movimientos a la derecha)
+     * Se llama tras validar la máquina; si no es reducible execute() usa el motor completo
+     */
+    void compileDFA();
+    bool hasDFA() const;
+
+    /**
+     * Función de transición compilada (se compila si hace falta)
+     * Deja de ser válida en cuanto se modifica la máquina
+     */
+    const TransitionTable& getProgram();
+
+    /**
+     * Limita las páginas de cada cinta en memoria; el resto se vuelca a un
+     * archivo temporal en directory. Se aplica en la siguiente initialize()
+     */
+    void setTapeSpill(size_t maxResidentPages, const std::string& directory);
+
+    /**
+     * Establece el presupuesto de pasos, celdas y memoria de cada ejecución
+     * Superarlo detiene la máquina con el veredicto exceededLimits()
+     */
+    void setResourceLimits(const ResourceLimits& limits);
+    const ResourceBudget& getResourceBudget() const;
+
+    /**
+     * Detiene las ejecuciones que repiten una configuración, o la repiten
+     * desplazada sobre cinta en blanco, con el veredicto hasDiverged()
+     * No se aplica a las entradas leídas bajo demanda (la cinta no es blanca
+     * más allá de lo leído) y desactiva el camino rápido del AFD
+     */
+    void setDivergenceCheck(bool enabled);
+    bool hasDivergenceCheck() const;
+
+    /**
+     * Permite que executeSteps() ejecute de una vez los bucles de búsqueda,
+     * copia y comparación (TapePrimitives); activado por defecto
+     */
+    void setNativePrimitives(bool enabled);
+    bool hasNativePrimitives() const;
+
+#ifdef MT_ENABLE_PROFILER
+    /**
+     * Perfil de la última ejecución
+     */
+    const ExecutionProfiler& getProfiler() const;
+#endif
+
     // Métodos de ejecución
     void initialize(const std::string& input);
     bool executeStep();
-    bool execute(const std::string& input, int maxSteps = 10000);
+
+    /**
+     * Ejecuta como mucho maxSteps pasos, los bucles de las primitivas nativas
+     * de una vez cuando se pueden usar (sin perfil, detección de ciclos,
+     * volcado a disco ni límites de celdas o memoria)
+     * Solo para quien no necesita ver cada paso; el resultado es el mismo
+     * @return Pasos ejecutados
+     */
+    long long executeSteps(long long maxSteps);
+
+    /**
+     * Recién inicializada con input, ejecuta la máquina con el AFD si es
+     * reducible y nada lo impide (perfil, detección de ciclos, límites de
+     * celdas o memoria); mismo resultado que executeSteps(maxSteps)
+     * @return false si no se usó el AFD (la máquina queda sin cambios)
+     */
+    bool scanInput(const std::string& input, long long maxSteps);
+    bool execute(const std::string& input, long long maxSteps = 10000);
+
+    /**
+     * Prepara una ejecución cuya entrada se lee bajo demanda de source
+     * Si ninguna transición mueve la primera cinta a la izquierda, las páginas
+     * que el cabezal deja atrás se liberan y la memoria no crece con la entrada
+     */
+    void initialize(InputSource& source);
+    bool execute(InputSource& source, long long maxSteps = 10000);
     void reset();
 
     // Métodos de consulta
     const State& getCurrentState() const;
+    int getCurrentStateId() const;  // Índice en la tabla compilada (-1 si se modificó tras initialize())
     const State& getInitialState() const;
     const Alphabet& getInputAlphabet() const;
     const Alphabet& getTapeAlphabet() const;
     const std::set<State>& getStates() const;
     const std::set<State>& getAcceptanceStates() const;
     const std::map<std::pair<std::string, std::string>, Transition>& getTransitions() const;
-    int getStepCount() const;
+    long long getStepCount() const;
+    long long getTransitionLookups() const;
     int getNumberOfTapes() const;  // Nuevo
     bool isMultiTape() const;      // Nuevo
     bool isHalted() const;
     bool wasAccepted() const;
+    bool exceededLimits() const;
+    const std::string& getLimitReason() const;
+    bool hasDiverged() const;
+    const std::string& getDivergenceReason() const;  // Ciclo encontrado
     std::string getTapeContent() const;
     std::string getTapeContent(int tapeIndex) const;  // Nuevo: obtener cinta específica
-    int getHeadPosition() const;
-    int getHeadPosition(int tapeIndex) const;  // Nuevo: posición de cabezal específico
+    long long getHeadPosition() const;
+    long long getHeadPosition(int tapeIndex) const;  // Nuevo: posición de cabezal específico
+    const Tape* getTape(int tapeIndex) const;  // nullptr si no existe
+    std::string getTapeWindow(int tapeIndex, bool markHead) const;  // Ventana alrededor del cabezal
+    long long writeTapeContent(int tapeIndex, int fd, const std::string& terminator = "") const;  // Contenido visible directo a un descriptor
 
     // Métodos de validación
     bool isValidInput(const std::string& input) const;
     bool validateTransition(const std::string& state, const std::string& symbol) const;
     bool hasState(const std::string& stateName) const;
 
+    /**
+     * Limita la representación de las cintas a radius celdas a cada lado del
+     * cabezal (0 = cinta completa). Afecta a getConfiguration() y a la traza.
+     */
+    void setTapeWindow(long long radius);
+    long long getTapeWindowRadius() const;
+
     // Método para obtener información
     std::string getConfiguration() const;
     std::string toString() const;
 
 private:
+    /**
+     * Descarta la función de transición compilada tras modificar la máquina
+     */
+    void invalidateProgram();
+
     /**
      * Aplica una transición
      */
     bool applyTransition();
+
+    /**
+     * Detiene la ejecución por superar el presupuesto de recursos
+     */
+    void stopForLimit(const std::string& reason);
 };
 
 #endif // TURING_MACHINE_H
@@ -0,0 +1,100 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <string>
+#include <vector>
+
+class TuringMachine;
+
+/**
+ * Resultado de una entrada ejecutada en un proceso trabajador
+ */
+struct PoolResult {
+    bool completed;              // false si el trabajador murió con esta entrada
+    bool accepted;
+    bool limitExceeded;
+    std::string limitReason;
+    std::string divergence;      // Ciclo encontrado (vacío si no se demostró que diverge)
+    long long steps;
+    std::string finalState;
+    std::vector<std::string> tapes;      // Contenido final de cada cinta
+    std::string error;           // Motivo si no se completó
+
+    PoolResult() : completed(false), accepted(false), limitExceeded(false), steps(0) {}
+};
+
+/**
+ * Grupo de procesos trabajadores para lotes muy grandes de entradas
+ *
+ * El coordinador carga y compila la máquina una sola vez y después crea los
+ * trabajadores con fork(): heredan la máquina compilada en páginas
+ * compartidas (copia en escritura, y la función de transición no se escribe
+ * durante la ejecución), así que ninguno vuelve a leer el archivo. Las
+ * entradas se reparten de una en una por tuberías al trabajador que queda
+ * libre y los resultados se devuelven en el orden de las entradas. Si un
+ * trabajador muere, su entrada se marca como fallida y se crea otro en su
+ * lugar con la misma máquina.
+ *
+ * Solo disponible donde existe fork() (no en Windows).
+ */
+class WorkerPool {
+private:
+    struct Worker {
+        int pid;
+        int taskFd;              // Coordinador -> trabajador
+        int resultFd;            // Trabajador -> coordinador
+        long long current;       // Entrada en curso (-1 = libre)
+    };
+
+    TuringMachine* machine;      // No es propiedad del grupo
+    int processCount;
+    std::vector<Worker> workers;
+
+public:
+    /**
+     * Constructor de WorkerPool
+     * @param tm Máquina ya cargada y validada
+     * @param processes Procesos trabajadores (0 = los núcleos disponibles)
+     */
+    WorkerPool(TuringMachine& tm, int processes);
+
+    /**
+     * Termina los trabajadores que sigan vivos
+     */
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * true si la plataforma permite crear procesos trabajadores
+     */
+    static bool isSupported();
+
+    /**
+     * Ejecuta todas las entradas repartidas entre los trabajadores
+     * Lanza MTException si no se pueden crear los procesos
+     */
+    std::vector<PoolResult> run(const std::vector<std::string>& inputs, long long maxSteps);
+
+    int getProcessCount() const { return processCount; }
+
+private:
+    /**
+     * Crea un trabajador y lo añade al grupo
+     */
+    void spawn(long long maxSteps);
+
+    /**
+     * Bucle del proceso trabajador: lee entradas, las ejecuta y devuelve el resultado
+     */
+    void workerMain(int taskFd, int resultFd, long long maxSteps);
+
+    /**
+     * Cierra las tuberías de un trabajador y recoge el proceso
+     * @return Estado de salida de waitpid()
+     */
+    int retire(Worker& worker);
+};
+
+#endif // WORKER_POOL_H
@@ -1,18 +1,21 @@
 #include "../include/Alphabet.h"
+#include "../include/MTException.h"
 #include <sstream>
 
 /**
  * Constructor por defecto
  */
 Alphabet::Alphabet() : blankSymbol("") {
+    resetCodes();
 }
 
 /**
  * Constructor con símbolo blanco
  */
 Alphabet::Alphabet(const std::string& blank) : blankSymbol(blank) {
+    resetCodes();
     if (!blank.empty()) {
-        symbols.insert(blank);
+        addSymbol(blank);
     }
 }
 
@@ -24,6 +27,15 @@ bool Alphabet::addSymbol(const std::string& symbol) {
         return false;
     }
     auto result = symbols.insert(symbol);
+    if (result.second) {
+        if (symbol.size() == 1) {
+            const uint8_t code = static_cast<uint8_t>(symbol[0]);
+            symbolClass.insert(code);
+            reassignCode(code);
+        } else {
+            assignCode(symbol);
+        }
+    }
     return result.second;  // true si se insertó, false si ya existía
 }
 
@@ -45,22 +57,28 @@ bool Alphabet::contains(const std::string& symbol) const {
 
 /**
  * Verifica si una cadena completa es válida
+ * Cada carácter se consulta en la tabla de clases de símbolo (vectorizado)
  */
 bool Alphabet::isValidString(const std::string& input) const {
-    for (char c : input) {
-        std::string symbol(1, c);
-        if (!contains(symbol)) {
-            return false;
-        }
-    }
-    return true;
+    return SimdKernels::allInSet(reinterpret_cast<const uint8_t*>(input.data()),
+                                 input.size(), symbolClass);
 }
 
 /**
  * Elimina un símbolo del alfabeto
  */
 bool Alphabet::removeSymbol(const std::string& symbol) {
-    return symbols.erase(symbol) > 0;
+    if (symbols.erase(symbol) == 0) {
+        return false;
+    }
+    // Reconstruir la tabla de clases; los códigos multicarácter se conservan
+    symbolClass.clear();
+    for (const auto& remaining : symbols) {
+        if (remaining.size() == 1) {
+            symbolClass.insert(static_cast<uint8_t>(remaining[0]));
+        }
+    }
+    return true;
 }
 
 /**
@@ -107,6 +125,8 @@ void Alphabet::setBlankSymbol(const std::string& blank) {
 void Alphabet::clear() {
     symbols.clear();
     blankSymbol.clear();
+    symbolClass.clear();
+    resetCodes();
 }
 
 /**
@@ -139,3 +159,81 @@ std::string Alphabet::toString() const {
     }
     return ss.str();
 }
+
+/**
+ * Obtiene el código de un byte de un símbolo
+ */
+uint8_t Alphabet::encode(const std::string& symbol) const {
+    if (symbol.size() == 1) {
+        return static_cast<uint8_t>(symbol[0]);
+    }
+    auto it = multiCharCodes.find(symbol);
+    if (it == multiCharCodes.end()) {
+        throw MTException("El símbolo '" + symbol + "' no tiene codificación en el alfabeto");
+    }
+    return it->second;
+}
+
+bool Alphabet::hasMultiCharSymbols() const {
+    return !multiCharCodes.empty();
+}
+
+const ByteSet& Alphabet::getSymbolClass() const {
+    return symbolClass;
+}
+
+void Alphabet::resetCodes() {
+    multiCharCodes.clear();
+    for (int c = 0; c < 256; c++) {
+        decodeTable[c] = std::string(1, static_cast<char>(c));
+    }
+}
+
+/**
+ * Asigna un byte libre a un símbolo de varios caracteres
+ * Solo bytes de control que no son espacios: los imprimibles y los de 0x80-0xFF
+ * (bytes de las secuencias UTF-8) pueden aparecer en la entrada
+ */
+void Alphabet::assignCode(const std::string& symbol) {
+    auto isFree = [&](int code) {
+        if (symbolClass.contains(static_cast<uint8_t>(code))) {
+            return false;
+        }
+        for (const auto& entry : multiCharCodes) {
+            if (entry.second == code) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    for (int code = 0x01; code < 0x20; code++) {
+        if (code >= 0x09 && code <= 0x0D) {
+            continue;
+        }
+        if (isFree(code)) {
+            multiCharCodes[symbol] = static_cast<uint8_t>(code);
+            decodeTable[code] = symbol;
+            return;
+        }
+    }
+    throw MTException("Demasiados símbolos de varios caracteres en el alfabeto (como mucho " +
+                      std::to_string(MAX_MULTI_CHAR_SYMBOLS) + "): '" + symbol + "'");
+}
+
+/**
+ * Si un símbolo de varios caracteres usa el byte de un símbolo de un carácter
+ * recién añadido, le asigna otro byte libre; si no, ambos se decodificarían
+ * como el de varios caracteres
+ */
+void Alphabet::reassignCode(uint8_t code) {
+    for (auto it = multiCharCodes.begin(); it != multiCharCodes.end(); ++it) {
+        if (it->second == code) {
+            const std::string symbol = it->first;
+            multiCharCodes.erase(it);
+            decodeTable[code] = std::string(1, static_cast<char>(code));
+            assignCode(symbol);
+            return;
+        }
+    }
+}
@@ -0,0 +1,98 @@
+#include "../include/ConfigurationStream.h"
+#include "../include/TuringMachine.h"
+
+long long ConfigurationView::step() const {
+    return machine->getStepCount();
+}
+
+std::string ConfigurationView::state() const {
+    return machine->getCurrentState().getName();
+}
+
+int ConfigurationView::tapeCount() const {
+    return machine->getNumberOfTapes();
+}
+
+long long ConfigurationView::head(int tapeIndex) const {
+    return machine->getHeadPosition(tapeIndex);
+}
+
+bool ConfigurationView::halted() const {
+    return machine->isHalted();
+}
+
+bool ConfigurationView::accepted() const {
+    return machine->wasAccepted();
+}
+
+std::string ConfigurationView::tape(int tapeIndex) const {
+    if (machine->getTapeWindowRadius() > 0) {
+        return machine->getTapeWindow(tapeIndex, false);
+    }
+    return machine->getTapeContent(tapeIndex);
+}
+
+std::string ConfigurationView::toString() const {
+    return machine->getConfiguration();
+}
+
+ConfigurationStream::iterator& ConfigurationStream::iterator::operator++() {
+    if (!stream->next()) {
+        stream = nullptr;
+    }
+    return *this;
+}
+
+ConfigurationStream::ConfigurationStream(TuringMachine& tm, long long maxSteps)
+    : machine(&tm), maxSteps(maxSteps), stride(1), runSteps(0), started(false), finished(false) {}
+
+ConfigurationStream& ConfigurationStream::every(long long k) {
+    stride = k > 0 ? k : 1;
+    return *this;
+}
+
+ConfigurationStream& ConfigurationStream::where(Filter predicate) {
+    filter = std::move(predicate);
+    return *this;
+}
+
+bool ConfigurationStream::advance() {
+    if (runSteps >= maxSteps || machine->isHalted() || !machine->executeStep()) {
+        finished = true;
+        return false;
+    }
+    runSteps++;
+    return true;
+}
+
+bool ConfigurationStream::accepts(bool last) const {
+    if (!last && machine->getStepCount() % stride != 0) {
+        return false;
+    }
+    return !filter || filter(current());
+}
+
+bool ConfigurationStream::next() {
+    if (!started) {
+        // La configuración inicial
+        started = true;
+        if (accepts(true)) {
+            return true;
+        }
+    }
+    while (!finished) {
+        if (!advance()) {
+            // La última configuración ya se entregó si coincidía con el paso
+            const bool delivered = runSteps == 0 || machine->getStepCount() % stride == 0;
+            return !delivered && accepts(true);
+        }
+        if (accepts(false)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+ConfigurationStream::iterator ConfigurationStream::begin() {
+    return iterator(next() ? this : nullptr);
+}
@@ -0,0 +1,311 @@
+#include "../include/DFAScanner.h"
+#include "../include/TuringMachine.h"
+#include <unordered_map>
+#include <queue>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DFA_SCANNER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace {
+
+/**
+ * Índice del bit menos significativo a 1 (mask != 0)
+ */
+inline unsigned lowestSetBit(unsigned mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+}  // namespace
+
+/**
+ * Constructor privado: solo se construye a través de compile()
+ */
+DFAScanner::DFAScanner() : initialState(0), blank('\0') {
+}
+
+/**
+ * Compila la MT en un AFD si es reducible
+ *
+ * Condiciones:
+ *  - Una sola cinta y símbolo blanco de un carácter
+ *  - Toda transición alcanzable desde q0 lee y escribe símbolos de un carácter
+ *    y mueve a la derecha
+ * Las transiciones que salen de estados de aceptación (salvo q0) nunca se
+ * ejecutan, porque la máquina se detiene al entrar en ellos, así que no
+ * impiden la reducción.
+ * Las máquinas con transiciones patrón (SymbolPattern) usan siempre el motor
+ * completo, que las expande.
+ */
+DFAScanner* DFAScanner::compile(const TuringMachine& tm) {
+    if (tm.getNumberOfTapes() != 1 || tm.hasTransitionPatterns()) {
+        return nullptr;
+    }
+    const std::string blankSymbol = tm.getTapeAlphabet().getBlankSymbol();
+    if (blankSymbol.size() != 1) {
+        return nullptr;
+    }
+
+    // Numerar los estados
+    std::unordered_map<std::string, int> ids;
+    ids.reserve(tm.getStates().size());
+    std::vector<State> stateList;
+    for (const auto& state : tm.getStates()) {
+        ids[state.getName()] = static_cast<int>(stateList.size());
+        stateList.push_back(State(state.getName()));
+    }
+    auto initialIt = ids.find(tm.getInitialState().getName());
+    if (initialIt == ids.end()) {
+        return nullptr;
+    }
+    const int numStates = static_cast<int>(stateList.size());
+    const int initial = initialIt->second;
+
+    std::vector<char> accepting(numStates, 0);
+    for (const auto& state : tm.getAcceptanceStates()) {
+        auto it = ids.find(state.getName());
+        if (it != ids.end()) {
+            accepting[it->second] = 1;
+        }
+    }
+
+    // Agrupar transiciones por estado de origen
+    std::vector<std::vector<const Transition*>> outgoing(numStates);
+    for (const auto& [key, trans] : tm.getTransitions()) {
+        auto it = ids.find(trans.getCurrentState().getName());
+        if (it == ids.end()) {
+            return nullptr;
+        }
+        outgoing[it->second].push_back(&trans);
+    }
+
+    // Recorrer solo la parte alcanzable de la máquina; la tabla se reserva
+    // después, para no crearla entera en las máquinas que no son un AFD
+    struct Edge {
+        int state;
+        unsigned char read;
+        int next;
+        char write;
+    };
+    std::vector<Edge> edges;
+    std::vector<char> visited(numStates, 0);
+    std::queue<int> pending;
+    pending.push(initial);
+    visited[initial] = 1;
+
+    while (!pending.empty()) {
+        int state = pending.front();
+        pending.pop();
+        if (accepting[state] && state != initial) {
+            continue;
+        }
+        for (const Transition* trans : outgoing[state]) {
+            const std::string read = trans->getReadSymbol();
+            const std::string write = trans->getWriteSymbol();
+            if (trans->getDirection() != 'R' || read.size() != 1 || write.size() != 1) {
+                return nullptr;
+            }
+            auto nextIt = ids.find(trans->getNextState().getName());
+            if (nextIt == ids.end()) {
+                return nullptr;
+            }
+            edges.push_back(Edge{state, static_cast<unsigned char>(read[0]), nextIt->second, write[0]});
+            if (!visited[nextIt->second]) {
+                visited[nextIt->second] = 1;
+                pending.push(nextIt->second);
+            }
+        }
+    }
+
+    std::vector<Entry> table(static_cast<size_t>(numStates) * 256, Entry{-1, '\0'});
+    for (const Edge& edge : edges) {
+        Entry& entry = table[static_cast<size_t>(edge.state) * 256 + edge.read];
+        entry.next = edge.next;
+        entry.write = edge.write;
+    }
+
+    DFAScanner* dfa = new DFAScanner();
+    dfa->stateList = std::move(stateList);
+    dfa->table = std::move(table);
+    dfa->accepting = std::move(accepting);
+    dfa->initialState = initial;
+    dfa->blank = blankSymbol[0];
+
+    // Bytes que dejan el estado igual y no modifican la cinta: se pueden saltar en bloque
+    dfa->loopBytes.assign(numStates, std::string());
+    for (int s = 0; s < numStates; s++) {
+        for (int c = 0; c < 256; c++) {
+            const Entry& entry = dfa->table[static_cast<size_t>(s) * 256 + c];
+            if (entry.next == s && static_cast<unsigned char>(entry.write) == c) {
+                dfa->loopBytes[s].push_back(static_cast<char>(c));
+            }
+        }
+    }
+    return dfa;
+}
+
+/**
+ * Ejecuta el AFD sobre la entrada
+ *
+ * Fase 1 recorre la entrada saltando con SIMD los tramos de bucle identidad.
+ * Fase 2 sigue sobre blancos; si detecta un ciclo de estados que solo escribe
+ * blancos, avanza directamente hasta maxSteps.
+ */
+DFAScanner::Result DFAScanner::run(const std::string& input, long long maxSteps) const {
+    Result result;
+    result.accepted = false;
+    result.halted = false;
+
+    const size_t length = input.size();
+    const char* data = input.data();
+    std::string cells = input;
+    int state = initialState;
+    long long steps = 0;
+    size_t pos = 0;
+    bool done = false;
+
+    // Fase 1: sobre la cadena de entrada
+    while (!done && steps < maxSteps && pos < length) {
+        if (!accepting[state]) {
+            size_t limit = std::min(length - pos, static_cast<size_t>(maxSteps - steps));
+            size_t skipped = loopSpan(state, data + pos, limit);
+            pos += skipped;
+            steps += static_cast<long long>(skipped);
+            if (steps >= maxSteps || pos >= length) {
+                break;
+            }
+        }
+
+        const Entry& entry = table[static_cast<size_t>(state) * 256 + static_cast<unsigned char>(data[pos])];
+        if (entry.next < 0) {
+            result.halted = true;
+            done = true;
+            break;
+        }
+        cells[pos] = entry.write;
+        pos++;
+        steps++;
+        state = entry.next;
+        if (accepting[state]) {
+            result.accepted = true;
+            result.halted = true;
+            done = true;
+        }
+    }
+
+    // Fase 2: el cabezal solo lee blancos
+    if (!done && steps < maxSteps) {
+        std::vector<int> seenAt(stateList.size(), -1);
+        std::vector<int> order;
+        bool detectCycles = true;
+
+        while (steps < maxSteps) {
+            if (detectCycles) {
+                if (seenAt[state] >= 0) {
+                    int start = seenAt[state];
+                    int period = static_cast<int>(order.size()) - start;
+                    bool blankCycle = true;
+                    for (size_t i = start; i < order.size(); i++) {
+                        if (table[static_cast<size_t>(order[i]) * 256 + static_cast<unsigned char>(blank)].write != blank) {
+                            blankCycle = false;
+                            break;
+                        }
+                    }
+                    if (blankCycle) {
+                        long long remaining = maxSteps - steps;
+                        state = order[start + remaining % period];
+                        steps = maxSteps;
+                        pos += remaining;
+                        break;
+                    }
+                    detectCycles = false;
+                } else {
+                    seenAt[state] = static_cast<int>(order.size());
+                    order.push_back(state);
+                }
+            }
+
+            const Entry& entry = table[static_cast<size_t>(state) * 256 + static_cast<unsigned char>(blank)];
+            if (entry.next < 0) {
+                result.halted = true;
+                break;
+            }
+            cells.resize(pos, blank);
+            cells.push_back(entry.write);
+            pos++;
+            steps++;
+            state = entry.next;
+            if (accepting[state]) {
+                result.accepted = true;
+                result.halted = true;
+                break;
+            }
+        }
+    }
+
+    // Entrada + 10 blancos como la cinta de referencia; Tape::load() amplía
+    // la extensión hasta la celda bajo el cabezal sin materializar blancos
+    cells.resize(std::max(length + 10, cells.size()), blank);
+
+    result.steps = steps;
+    result.finalState = state;
+    result.cells = std::move(cells);
+    result.headPosition = static_cast<long long>(pos);
+    return result;
+}
+
+const State& DFAScanner::getState(int index) const {
+    return stateList[index];
+}
+
+/**
+ * Longitud del prefijo formado por bytes de bucle identidad del estado
+ */
+size_t DFAScanner::loopSpan(int state, const char* data, size_t length) const {
+    const std::string& bytes = loopBytes[state];
+    if (bytes.empty()) {
+        return 0;
+    }
+
+    size_t i = 0;
+#ifdef DFA_SCANNER_SSE2
+    if (bytes.size() <= 4) {
+        // Hasta 4 bytes distintos: comparar 16 celdas por iteración
+        const __m128i b0 = _mm_set1_epi8(bytes[0]);
+        const __m128i b1 = _mm_set1_epi8(bytes[bytes.size() > 1 ? 1 : 0]);
+        const __m128i b2 = _mm_set1_epi8(bytes[bytes.size() > 2 ? 2 : 0]);
+        const __m128i b3 = _mm_set1_epi8(bytes[bytes.size() > 3 ? 3 : 0]);
+        for (; i + 16 <= length; i += 16) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            __m128i hit = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(chunk, b0), _mm_cmpeq_epi8(chunk, b1)),
+                _mm_or_si128(_mm_cmpeq_epi8(chunk, b2), _mm_cmpeq_epi8(chunk, b3)));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hit));
+            if (mask != 0xFFFFu) {
+                return i + lowestSetBit(~mask & 0xFFFFu);
+            }
+        }
+    }
+#endif
+
+    const Entry* row = &table[static_cast<size_t>(state) * 256];
+    for (; i < length; i++) {
+        unsigned char c = static_cast<unsigned char>(data[i]);
+        if (row[c].next != state || static_cast<unsigned char>(row[c].write) != c) {
+            break;
+        }
+    }
+    return i;
+}
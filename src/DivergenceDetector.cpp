@@ -0,0 +1,128 @@
+#include "../include/DivergenceDetector.h"
+#include "../include/Tape.h"
+#include "../include/SimdKernels.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+// Comparaciones permitidas antes del primer paso (periodos cortos al principio)
+constexpr long long INITIAL_BUDGET = 1 << 16;
+
+}  // namespace
+
+DivergenceDetector::DivergenceDetector()
+    : active(false), anchorState(-1), anchorStep(0), nextAnchor(1), budget(INITIAL_BUDGET),
+      pendingCost(0) {
+}
+
+void DivergenceDetector::reset(bool enabled) {
+    active = enabled;
+    anchors.clear();
+    anchorState = -1;
+    anchorStep = 0;
+    nextAnchor = 1;
+    budget = INITIAL_BUDGET;
+    pendingCost = 0;
+    reason.clear();
+}
+
+void DivergenceDetector::anchor(long long step, int state, const TapeBank& tapes) {
+    anchors.resize(static_cast<size_t>(tapes.size()));
+    for (int i = 0; i < tapes.size(); i++) {
+        const Tape& tape = *tapes[i];
+        TapeAnchor& saved = anchors[static_cast<size_t>(i)];
+        saved.head = tape.getHeadIndex();
+        saved.blank = tape.getBlankCode();
+        saved.leftEdge = tape.getLeftEdge();
+        saved.rightEdge = tape.getRightEdge();
+        saved.first = std::max(saved.leftEdge, saved.head - WINDOW);
+        const long long last = std::min(saved.rightEdge, saved.head + WINDOW + 1);
+        saved.cells.resize(static_cast<size_t>(last - saved.first));
+        tape.copyCodes(saved.first, last, saved.cells.data());
+        saved.minHead = saved.head;
+        saved.maxHead = saved.head;
+    }
+    anchorCodes.resize(anchors.size());
+    currentCodes.resize(anchors.size());
+    tapes.readCodes(anchorCodes.data());
+    anchorState = state;
+    anchorStep = step;
+    pendingCost = 0;
+    nextAnchor = step * 2;
+}
+
+void DivergenceDetector::span(const TapeAnchor& saved, long long shift, long long& first, long long& last) {
+    // Zona leída desde el ancla; si el cabezal avanza, también todo lo que tenía delante
+    first = saved.minHead;
+    last = saved.maxHead;
+    if (shift > 0) {
+        last = std::max(last, saved.rightEdge - 1);
+    } else if (shift < 0) {
+        first = std::min(first, saved.leftEdge);
+    }
+}
+
+bool DivergenceDetector::repeats(long long step, const TapeBank& tapes) {
+    // Primero, que cada zona esté dentro de la ventana del ancla y quepa en el presupuesto
+    long long total = 0;
+    for (int i = 0; i < tapes.size(); i++) {
+        const TapeAnchor& saved = anchors[static_cast<size_t>(i)];
+        long long first, last;
+        span(saved, tapes[i]->getHeadIndex() - saved.head, first, last);
+        if (first < saved.head - WINDOW || last > saved.head + WINDOW) {
+            return false;
+        }
+        total += last - first + 1;
+    }
+    // Hasta reunir presupuesto para esta comparación no se vuelve a intentar
+    pendingCost = total;
+    if (total > budget) {
+        return false;
+    }
+    budget -= total;
+
+    bool translated = false;
+    for (int i = 0; i < tapes.size(); i++) {
+        const TapeAnchor& saved = anchors[static_cast<size_t>(i)];
+        const long long shift = tapes[i]->getHeadIndex() - saved.head;
+        long long first, last;
+        span(saved, shift, first, last);
+        const size_t length = static_cast<size_t>(last - first + 1);
+        if (scratch.size() < length) {
+            scratch.resize(length);
+        }
+        tapes[i]->copyCodes(first + shift, last + shift + 1, scratch.data());
+
+        // Fuera de las celdas guardadas (la extensión alcanzada en el ancla) todo era blanco
+        const long long storedEnd = saved.first + static_cast<long long>(saved.cells.size());
+        const long long from = std::min(std::max(first, saved.first), last + 1);
+        const long long to = std::max(from, std::min(last + 1, storedEnd));
+        const uint8_t* current = scratch.data();
+        const size_t before = static_cast<size_t>(from - first);
+        const size_t after = static_cast<size_t>(last + 1 - to);
+        if (SimdKernels::findFirstNotEqual(current, before, saved.blank) != before ||
+            SimdKernels::findFirstNotEqual(current + (length - after), after, saved.blank) != after) {
+            return false;
+        }
+        if (to > from && std::memcmp(current + before, &saved.cells[static_cast<size_t>(from - saved.first)],
+                                     static_cast<size_t>(to - from)) != 0) {
+            return false;
+        }
+        translated = translated || shift != 0;
+    }
+
+    const std::string period = "periodo " + std::to_string(step - anchorStep) + ", desde el paso " +
+                               std::to_string(anchorStep);
+    if (!translated) {
+        reason = "ciclo (" + period + ")";
+        return true;
+    }
+    reason = "ciclo trasladado (" + period + ", desplazamiento ";
+    for (int i = 0; i < tapes.size(); i++) {
+        const long long shift = tapes[i]->getHeadIndex() - anchors[static_cast<size_t>(i)].head;
+        reason += (i > 0 ? " " : "") + std::string(shift > 0 ? "+" : "") + std::to_string(shift);
+    }
+    reason += ")";
+    return true;
+}
@@ -0,0 +1,174 @@
+#include "../include/ExecutionContext.h"
+#include "../include/TransitionTable.h"
+#include "../include/TapePrimitives.h"
+#include "../include/MTException.h"
+#include <algorithm>
+
+ExecutionContext::ExecutionContext(std::shared_ptr<const MachineProgram> compiled)
+    : program(std::move(compiled)), table(&program->getTable()), divergenceCheck(false), spillResidentPages(0),
+      nativePrimitives(true), stateId(0), stepCount(0),
+      lookupCount(0), accepted(false), halted(true), limitExceeded(false), diverged(false) {
+    stateId = table->getInitialState();
+    tapes.resize(program->getNumberOfTapes());
+    readBuffer.assign(static_cast<size_t>(tapes.size()), 0);
+}
+
+void ExecutionContext::setResourceLimits(const ResourceLimits& limits) {
+    budget.setLimits(limits);
+}
+
+void ExecutionContext::setDivergenceCheck(bool enabled) {
+    divergenceCheck = enabled;
+}
+
+void ExecutionContext::setTapeSpill(size_t maxResidentPages, const std::string& directory) {
+    spillResidentPages = maxResidentPages;
+    spillDirectory = directory;
+    // Como en TuringMachine: las cintas se recrean con la nueva configuración
+    tapes.clear();
+}
+
+void ExecutionContext::setNativePrimitives(bool enabled) {
+    nativePrimitives = enabled;
+}
+
+void ExecutionContext::reset(const std::string& input) {
+    stateId = table->getInitialState();
+    stepCount = 0;
+    lookupCount = 0;
+    accepted = false;
+    halted = false;
+    limitExceeded = false;
+    diverged = false;
+    limitReason.clear();
+    divergence.reset(divergenceCheck);
+
+    const Alphabet& alphabet = program->getTapeAlphabet();
+    const std::string empty;
+    // Las cintas de la ejecución anterior se reinician conservando sus páginas
+    try {
+        for (int i = 0; i < tapes.size(); i++) {
+            tapes.prepare(i, i == 0 ? input : empty, alphabet.getBlankSymbol(), &alphabet, &budget);
+            if (spillResidentPages > 0) {
+                tapes[i]->enableSpill(spillResidentPages, spillDirectory);
+            }
+        }
+    } catch (const ResourceLimitException& e) {
+        stopForLimit(e.what());
+    }
+    budget.resetPeak();
+}
+
+bool ExecutionContext::step() {
+    if (halted) {
+        return false;
+    }
+    const long long stepLimit = budget.getLimits().maxSteps;
+    if (stepLimit > 0 && stepCount >= stepLimit) {
+        stopForLimit("pasos (" + std::to_string(stepLimit) + ")");
+        return false;
+    }
+
+    try {
+        tapes.readCodes(readBuffer.data());
+        lookupCount++;
+        const TransitionTable::Entry* entry = table->find(stateId, readBuffer.data());
+        if (entry == nullptr) {
+            halted = true;
+            return false;
+        }
+        const uint8_t* writeCodes = table->getWriteCodes(*entry);
+        const int8_t* moves = table->getMoves(*entry);
+        for (int i = 0; i < tapes.size(); i++) {
+            if (!entry->encodable) {
+                // Símbolo sin código: write() informa del error
+                tapes[i]->write(entry->source->getWriteSymbols()[i]);
+            }
+            tapes.writeAndMove(i, writeCodes[i], moves[i]);
+        }
+        stateId = entry->next;
+    } catch (const ResourceLimitException& e) {
+        stopForLimit(e.what());
+        return false;
+    }
+    stepCount++;
+
+    if (table->isAccepting(stateId)) {
+        accepted = true;
+        halted = true;
+    } else if (divergence.isActive() && divergence.observe(stepCount, stateId, tapes)) {
+        diverged = true;
+        halted = true;
+    }
+    return true;
+}
+
+bool ExecutionContext::run(long long maxSteps) {
+    // Como TuringMachine::executeSteps(): los bucles de las primitivas de una vez
+    const bool native = nativePrimitives && !divergence.isActive() && spillResidentPages == 0 && budget.isUnlimited();
+    const long long stepLimit = budget.getLimits().maxSteps;
+    long long taken = 0;
+    while (taken < maxSteps && !halted) {
+        if (native) {
+            long long limit = maxSteps - taken;
+            if (stepLimit > 0) {
+                limit = std::min(limit, stepLimit - stepCount);
+            }
+            const long long run = TapePrimitives::execute(*table, stateId, tapes, readBuffer.data(), primitiveBuffer,
+                                                          limit);
+            if (run > 0) {
+                stepCount += run;
+                lookupCount += run;
+                taken += run;
+                continue;
+            }
+        }
+        if (!step()) {
+            break;
+        }
+        taken++;
+    }
+    return accepted;
+}
+
+bool ExecutionContext::execute(const std::string& input, long long maxSteps) {
+    reset(input);
+    return run(maxSteps);
+}
+
+const std::string& ExecutionContext::getStateName() const {
+    return table->getState(stateId).getName();
+}
+
+std::string ExecutionContext::getTapeContent(int tapeIndex) const {
+    if (tapeIndex >= 0 && tapeIndex < tapes.size() && tapes[tapeIndex] != nullptr) {
+        return tapes[tapeIndex]->getVisibleContent();
+    }
+    return "";
+}
+
+long long ExecutionContext::getHeadPosition(int tapeIndex) const {
+    if (tapeIndex >= 0 && tapeIndex < tapes.size() && tapes[tapeIndex] != nullptr) {
+        return tapes[tapeIndex]->getHeadPosition();
+    }
+    return -1;
+}
+
+std::string ExecutionContext::getConfiguration() const {
+    std::string config = "Estado: " + getStateName();
+    if (tapes.size() > 1) {
+        for (int i = 0; i < tapes.size(); i++) {
+            config += "\nCinta " + std::to_string(i + 1) + ": [" + getTapeContent(i) + "], Cabezal: " +
+                      std::to_string(getHeadPosition(i));
+        }
+    } else {
+        config += ", Cinta: [" + getTapeContent(0) + "], Cabezal: " + std::to_string(getHeadPosition(0));
+    }
+    return config;
+}
+
+void ExecutionContext::stopForLimit(const std::string& reason) {
+    limitExceeded = true;
+    limitReason = reason;
+    halted = true;
+}
@@ -0,0 +1,127 @@
+#include "../include/ExecutionProfiler.h"
+#include "../include/TuringMachine.h"
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+namespace {
+
+/**
+ * Entrada genérica de una lista ordenada por número de ejecuciones
+ */
+struct Ranked {
+    std::string label;
+    unsigned long long hits;
+};
+
+void sortRanked(std::vector<Ranked>& entries) {
+    std::stable_sort(entries.begin(), entries.end(), [](const Ranked& a, const Ranked& b) {
+        return a.hits > b.hits;
+    });
+}
+
+void printRanked(std::ostringstream& out, const std::vector<Ranked>& entries,
+                 unsigned long long total, size_t top) {
+    size_t shown = 0;
+    for (const auto& entry : entries) {
+        if (shown == top || entry.hits == 0) {
+            break;
+        }
+        double percent = total > 0 ? 100.0 * static_cast<double>(entry.hits) / static_cast<double>(total) : 0.0;
+        out << "  " << std::setw(3) << (shown + 1) << ". " << entry.label << ": " << entry.hits
+            << " (" << std::fixed << std::setprecision(1) << percent << "%)\n";
+        shown++;
+    }
+    if (shown == 0) {
+        out << "  (ninguna)\n";
+    }
+}
+
+}  // namespace
+
+void ExecutionProfiler::reset(size_t transitionCount) {
+    transitionHits.assign(transitionCount, 0);
+}
+
+unsigned long long ExecutionProfiler::getTransitionHits(int transitionId) const {
+    if (transitionId < 0 || static_cast<size_t>(transitionId) >= transitionHits.size()) {
+        return 0;
+    }
+    return transitionHits[static_cast<size_t>(transitionId)];
+}
+
+unsigned long long ExecutionProfiler::getTotalHits() const {
+    unsigned long long total = 0;
+    for (unsigned long long hits : transitionHits) {
+        total += hits;
+    }
+    return total;
+}
+
+std::string ExecutionProfiler::report(const TuringMachine& tm, size_t top) const {
+    const unsigned long long total = getTotalHits();
+    const int numTapes = tm.getNumberOfTapes();
+
+    std::vector<Ranked> byTransition;
+    std::map<std::string, unsigned long long> byState;
+    std::map<std::pair<std::string, std::string>, unsigned long long> byEdge;
+    std::vector<unsigned long long> moves(static_cast<size_t>(numTapes) * 3, 0);
+
+    for (const auto& [key, trans] : tm.getTransitions()) {
+        unsigned long long hits = getTransitionHits(trans.getId());
+        byTransition.push_back({trans.toString(), hits});
+        if (hits == 0) {
+            continue;
+        }
+        const std::string& from = trans.getCurrentState().getName();
+        const std::string& to = trans.getNextState().getName();
+        byState[from] += hits;
+        byEdge[{from, to}] += hits;
+
+        const auto& directions = trans.getDirections();
+        for (int i = 0; i < numTapes && i < static_cast<int>(directions.size()); i++) {
+            size_t kind = directions[i] == 'L' ? 0 : (directions[i] == 'R' ? 1 : 2);
+            moves[static_cast<size_t>(i) * 3 + kind] += hits;
+        }
+    }
+
+    std::vector<Ranked> states;
+    for (const auto& [name, hits] : byState) {
+        states.push_back({name, hits});
+    }
+
+    // Bucles: autolazos q -> q y ciclos de dos estados a <-> b (peso = mínimo de ambos sentidos)
+    std::vector<Ranked> loops;
+    for (const auto& [edge, hits] : byEdge) {
+        if (edge.first == edge.second) {
+            loops.push_back({edge.first + " -> " + edge.second, hits});
+        } else if (edge.first < edge.second) {
+            auto back = byEdge.find({edge.second, edge.first});
+            if (back != byEdge.end()) {
+                loops.push_back({edge.first + " <-> " + edge.second, std::min(hits, back->second)});
+            }
+        }
+    }
+
+    sortRanked(byTransition);
+    sortRanked(states);
+    sortRanked(loops);
+
+    std::ostringstream out;
+    out << "\n=== Perfil de Ejecución ===\n";
+    out << "Transiciones ejecutadas: " << total << "\n";
+    out << "Transiciones más usadas:\n";
+    printRanked(out, byTransition, total, top);
+    out << "Estados más activos (transiciones salientes):\n";
+    printRanked(out, states, total, top);
+    out << "Movimientos del cabezal:\n";
+    for (int i = 0; i < numTapes; i++) {
+        out << "  Cinta " << (i + 1) << ": L=" << moves[static_cast<size_t>(i) * 3]
+            << " R=" << moves[static_cast<size_t>(i) * 3 + 1]
+            << " S=" << moves[static_cast<size_t>(i) * 3 + 2] << "\n";
+    }
+    out << "Bucles más calientes entre estados:\n";
+    printRanked(out, loops, total, top);
+    return out.str();
+}
@@ -0,0 +1,134 @@
+#include "../include/InputSource.h"
+#include "../include/MTException.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+/**
+ * Longitud del salto de línea ("\n" o "\r\n") con el que terminan los bytes, o 0
+ */
+size_t lineBreakLength(const uint8_t* bytes, size_t count) {
+    if (count == 0 || bytes[count - 1] != '\n') {
+        return 0;
+    }
+    return count >= 2 && bytes[count - 2] == '\r' ? 2 : 1;
+}
+
+/**
+ * Bytes finales que pueden formar parte del salto de línea final
+ * (un "\r" suelto puede ir seguido del "\n" en la lectura siguiente)
+ */
+size_t pendingLength(const uint8_t* bytes, size_t count) {
+    if (count > 0 && bytes[count - 1] == '\r') {
+        return 1;
+    }
+    return lineBreakLength(bytes, count);
+}
+
+}  // namespace
+
+InputSource::InputSource(const std::string& path)
+    : fileDescriptor(-1), ownsDescriptor(false), finished(false), bytesRead(0), name(path),
+      held(), heldCount(0) {
+    if (path == "-") {
+        fileDescriptor = 0;
+        return;
+    }
+#ifdef _WIN32
+    fileDescriptor = _open(path.c_str(), _O_RDONLY | _O_BINARY);
+#else
+    fileDescriptor = open(path.c_str(), O_RDONLY);
+#endif
+    if (fileDescriptor < 0) {
+        throw MTException("No se pudo abrir la entrada: " + path + " (" + std::strerror(errno) + ")");
+    }
+    ownsDescriptor = true;
+}
+
+InputSource::~InputSource() {
+    if (ownsDescriptor) {
+#ifdef _WIN32
+        _close(fileDescriptor);
+#else
+        close(fileDescriptor);
+#endif
+    }
+}
+
+size_t InputSource::read(uint8_t* buffer, size_t capacity) {
+    while (capacity > 0) {
+        if (heldCount >= capacity) {
+            // Lo retenido llena el búfer: leer un byte más para saber si la entrada sigue
+            uint8_t next;
+            if (readRaw(&next, 1) == 0) {
+                return releaseHeld(buffer, capacity);
+            }
+            held[heldCount++] = next;
+            const size_t count = std::min(heldCount - pendingLength(held, heldCount), capacity);
+            if (count == 0) {
+                continue;
+            }
+            std::memcpy(buffer, held, count);
+            heldCount -= count;
+            std::memmove(held, held + count, heldCount);
+            bytesRead += static_cast<long long>(count);
+            return count;
+        }
+
+        // Lo retenido va delante y se lee directamente detrás
+        std::memcpy(buffer, held, heldCount);
+        const size_t count = readRaw(buffer + heldCount, capacity - heldCount);
+        if (count == 0) {
+            return releaseHeld(buffer, capacity);
+        }
+        const size_t total = heldCount + count;
+        heldCount = pendingLength(buffer, total);
+        std::memcpy(held, buffer + total - heldCount, heldCount);
+        if (total > heldCount) {
+            bytesRead += static_cast<long long>(total - heldCount);
+            return total - heldCount;
+        }
+    }
+    return 0;
+}
+
+size_t InputSource::readRaw(uint8_t* buffer, size_t capacity) {
+    while (!finished) {
+#ifdef _WIN32
+        int count = _read(fileDescriptor, buffer, static_cast<unsigned>(capacity));
+#else
+        ssize_t count = ::read(fileDescriptor, buffer, capacity);
+#endif
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw MTException("Error al leer la entrada " + name + ": " + std::strerror(errno));
+        }
+        if (count == 0) {
+            finished = true;
+            break;
+        }
+        return static_cast<size_t>(count);
+    }
+    return 0;
+}
+
+size_t InputSource::releaseHeld(uint8_t* buffer, size_t capacity) {
+    heldCount -= lineBreakLength(held, heldCount);
+    const size_t count = std::min(heldCount, capacity);
+    std::memcpy(buffer, held, count);
+    heldCount -= count;
+    std::memmove(held, held + count, heldCount);
+    bytesRead += static_cast<long long>(count);
+    return count;
+}
@@ -0,0 +1,245 @@
+#include "../include/LockstepEngine.h"
+#include "../include/TuringMachine.h"
+#include "../include/SimdKernels.h"
+#include "../include/MTException.h"
+#include <algorithm>
+#include <map>
+
+namespace {
+
+// Blancos que se añaden tras la entrada, como en Tape
+const long long INITIAL_PADDING = 10;
+
+// Bits del código de movimiento y del símbolo escrito en cada entrada de la tabla
+const int32_t MOVE_MASK = 0x3;
+const int WRITE_SHIFT = 2;
+const int NEXT_SHIFT = 10;
+
+// Estados representables en una entrada de 31 bits
+const size_t MAX_STATES = size_t(1) << 21;
+
+/**
+ * Estado de una lane en ejecución
+ */
+struct Lane {
+    long long input;                // Índice de la entrada (-1 si la lane está libre)
+    int32_t state;
+    long long steps;
+    std::vector<uint8_t> cells;     // Celdas en memoria (se amplían al doble por cada lado)
+    long long head;                 // Índice en cells del cabezal
+    long long leftmost;             // Índice en cells de la celda más a la izquierda alcanzada
+};
+
+}  // namespace
+
+/**
+ * Constructor privado: solo se construye a través de compile()
+ */
+LockstepEngine::LockstepEngine() : initialState(0), blankCode(0) {
+}
+
+LockstepEngine* LockstepEngine::compile(const TuringMachine& tm) {
+    // Las transiciones patrón solo las expande TransitionTable
+    if (tm.getNumberOfTapes() != 1 || tm.hasTransitionPatterns()) {
+        return nullptr;
+    }
+
+    std::map<std::string, int> ids;
+    std::vector<State> stateList;
+    auto idOf = [&](const State& state) {
+        auto it = ids.find(state.getName());
+        if (it != ids.end()) {
+            return it->second;
+        }
+        int id = static_cast<int>(stateList.size());
+        ids[state.getName()] = id;
+        stateList.push_back(state);
+        return id;
+    };
+    for (const auto& state : tm.getStates()) {
+        idOf(state);
+    }
+    const int initial = idOf(tm.getInitialState());
+
+    const Alphabet& alphabet = tm.getTapeAlphabet();
+    struct Compiled {
+        int state;
+        uint8_t read;
+        int32_t value;
+    };
+    std::vector<Compiled> compiled;
+    try {
+        for (const auto& [key, trans] : tm.getTransitions()) {
+            uint8_t read;
+            try {
+                read = alphabet.encode(trans.getReadSymbol());
+            } catch (const MTException&) {
+                continue;  // Nunca puede leerse
+            }
+            const char dir = trans.getDirection();
+            int32_t move = dir == 'L' ? 0 : (dir == 'R' ? 2 : 1);
+            int32_t write = alphabet.encode(trans.getWriteSymbol());
+            int state = idOf(trans.getCurrentState());
+            int next = idOf(trans.getNextState());
+            compiled.push_back({state, read, (next << NEXT_SHIFT) | (write << WRITE_SHIFT) | move});
+        }
+    } catch (const MTException&) {
+        // Símbolo escrito sin código: lo resuelve el motor completo
+        return nullptr;
+    }
+    for (const auto& state : tm.getAcceptanceStates()) {
+        idOf(state);
+    }
+    if (stateList.size() >= MAX_STATES) {
+        return nullptr;
+    }
+
+    LockstepEngine* engine = new LockstepEngine();
+    engine->table.assign(stateList.size() * 256 + 1, -1);
+    for (const Compiled& entry : compiled) {
+        engine->table[static_cast<size_t>(entry.state) * 256 + entry.read] = entry.value;
+    }
+    engine->accepting.assign(stateList.size(), 0);
+    for (const auto& state : tm.getAcceptanceStates()) {
+        engine->accepting[ids[state.getName()]] = 1;
+    }
+    engine->decodeTable.resize(256);
+    for (int code = 0; code < 256; code++) {
+        engine->decodeTable[code] = alphabet.decode(static_cast<uint8_t>(code));
+    }
+    engine->stateList = std::move(stateList);
+    engine->initialState = initial;
+    engine->blankCode = alphabet.encode(alphabet.getBlankSymbol());
+    return engine;
+}
+
+/**
+ * Ejecuta las entradas por lanes
+ *
+ * Cada iteración calcula el índice de tabla de todas las lanes (las libres
+ * apuntan al centinela), los resuelve con un gather y aplica escritura y
+ * movimiento a las lanes activas. Al terminar una lane se guarda su resultado
+ * y se carga la siguiente entrada pendiente.
+ */
+std::vector<LockstepEngine::Result> LockstepEngine::run(const std::vector<std::string>& inputs,
+                                                         long long maxSteps) const {
+    std::vector<Result> results(inputs.size());
+    const int32_t sentinel = static_cast<int32_t>(table.size() - 1);
+
+    Lane lanes[LANES];
+    int32_t indices[LANES];
+    int32_t entries[LANES];
+    size_t nextInput = 0;
+    int active = 0;
+
+    auto finish = [&](Lane& lane, bool accepted, bool halted) {
+        Result& result = results[lane.input];
+        result.accepted = accepted;
+        result.halted = halted;
+        result.steps = lane.steps;
+        result.finalState = lane.state;
+        // Como en Tape, la posición se cuenta desde la celda más a la izquierda alcanzada
+        result.headPosition = lane.head - lane.leftmost;
+        result.tape = visibleContent(lane.cells);
+        lane.input = -1;
+        active--;
+    };
+
+    auto load = [&](Lane& lane) {
+        while (nextInput < inputs.size()) {
+            const std::string& input = inputs[nextInput];
+            lane.input = static_cast<long long>(nextInput++);
+            lane.state = initialState;
+            lane.steps = 0;
+            lane.cells.assign(input.begin(), input.end());
+            lane.cells.resize(input.size() + INITIAL_PADDING, blankCode);
+            lane.head = 0;
+            lane.leftmost = 0;
+            active++;
+            if (maxSteps > 0) {
+                return;
+            }
+            finish(lane, false, false);
+        }
+    };
+
+    for (Lane& lane : lanes) {
+        lane.input = -1;
+        load(lane);
+    }
+
+    while (active > 0) {
+        for (int l = 0; l < LANES; l++) {
+            const Lane& lane = lanes[l];
+            indices[l] = lane.input < 0 ? sentinel
+                                        : lane.state * 256 + lane.cells[static_cast<size_t>(lane.head)];
+        }
+        SimdKernels::gather32(table.data(), indices, entries, LANES);
+
+        for (int l = 0; l < LANES; l++) {
+            Lane& lane = lanes[l];
+            if (lane.input < 0) {
+                continue;
+            }
+            const int32_t entry = entries[l];
+            if (entry < 0) {
+                // Sin transición: se detiene sin aceptar
+                finish(lane, false, true);
+                load(lane);
+                continue;
+            }
+
+            lane.cells[static_cast<size_t>(lane.head)] = static_cast<uint8_t>(entry >> WRITE_SHIFT);
+            switch (entry & MOVE_MASK) {
+                case 0:
+                    if (lane.head == 0) {
+                        // Ampliar por la izquierda al doble
+                        size_t grow = std::max<size_t>(lane.cells.size(), 16);
+                        lane.cells.insert(lane.cells.begin(), grow, blankCode);
+                        lane.head += static_cast<long long>(grow);
+                        lane.leftmost += static_cast<long long>(grow);
+                    }
+                    lane.head--;
+                    lane.leftmost = std::min(lane.leftmost, lane.head);
+                    break;
+                case 2:
+                    lane.head++;
+                    if (lane.head == static_cast<long long>(lane.cells.size())) {
+                        lane.cells.resize(lane.cells.size() * 2, blankCode);
+                    }
+                    break;
+                default:
+                    break;
+            }
+            lane.state = entry >> NEXT_SHIFT;
+            lane.steps++;
+
+            if (accepting[lane.state]) {
+                finish(lane, true, true);
+                load(lane);
+            } else if (lane.steps >= maxSteps) {
+                finish(lane, false, false);
+                load(lane);
+            }
+        }
+    }
+
+    return results;
+}
+
+const State& LockstepEngine::getState(int index) const {
+    return stateList[index];
+}
+
+std::string LockstepEngine::visibleContent(const std::vector<uint8_t>& cells) const {
+    auto first = std::find_if(cells.begin(), cells.end(), [this](uint8_t c) { return c != blankCode; });
+    if (first == cells.end()) {
+        return "";
+    }
+    auto last = std::find_if(cells.rbegin(), cells.rend(), [this](uint8_t c) { return c != blankCode; }).base();
+    std::string content;
+    for (auto it = first; it != last; ++it) {
+        content += decodeTable[*it];
+    }
+    return content;
+}
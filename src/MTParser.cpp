@@ -1,8 +1,24 @@
 #include "../include/MTParser.h"
 #include "../include/MTException.h"
+#include "../include/SymbolPattern.h"
 #include <fstream>
-#include <sstream>
 #include <iostream>
+#include <algorithm>
+#include <thread>
+#include <unordered_set>
+
+namespace {
+
+// Transiciones por hilo a partir de las cuales se valida en paralelo
+const size_t VALIDATION_CHUNK = 16384;
+
+// Errores distintos que se muestran como máximo
+const size_t MAX_LISTED_ERRORS = 50;
+
+// Transiciones concretas que pueden generar los patrones en total
+const double MAX_PATTERN_EXPANSION = 1 << 22;
+
+}  // namespace
 
 /**
  * Parsea un archivo y retorna una Máquina de Turing
@@ -23,7 +39,7 @@ TuringMachine* MTParser::parseFile(const std::string& filename) {
         while (std::getline(file, outLine)) {
             lineNumber++;
             outLine = trim(outLine);
-            if (!isCommentOrEmpty(outLine)) {
+            if (!outLine.empty() && outLine[0] != '#') {
                 return true;
             }
         }
@@ -86,11 +102,27 @@ TuringMachine* MTParser::parseFile(const std::string& filename) {
         }
     }
 
+    // Clase de símbolos: "@nombre s1 s2 ..." (no puede empezar por un estado de Q)
+    auto parseSymbolClass = [&](const std::vector<std::string>& tokens) -> bool {
+        if (tokens[0].size() < 2 || tokens[0][0] != '@' || tm->hasState(tokens[0])) {
+            return false;
+        }
+        if (tokens.size() < 2) {
+            throw MTException("La clase de símbolos " + tokens[0] + " de la línea " +
+                              std::to_string(lineNumber) + " no tiene símbolos");
+        }
+        tm->addSymbolClass(tokens[0].substr(1), std::vector<std::string>(tokens.begin() + 1, tokens.end()));
+        return true;
+    };
+
     // Línea 7: Número de cintas (OPCIONAL - si no está, es monocinta)
     int numberOfTapes = 1;  // Por defecto monocinta
     if (getNextValidLine(line)) {
         auto tokens = tokenize(line);
-        if (!tokens.empty()) {
+        if (!tokens.empty() && parseSymbolClass(tokens)) {
+            // Sin número de cintas: monocinta, y las clases empiezan ya
+            tm->setNumberOfTapes(1);
+        } else if (!tokens.empty()) {
             // Intentar parsear como número
             try {
                 numberOfTapes = std::stoi(tokens[0]);
@@ -123,7 +155,10 @@ TuringMachine* MTParser::parseFile(const std::string& filename) {
     // Líneas 8+: Transiciones
     while (getNextValidLine(line)) {
         auto tokens = tokenize(line);
-        
+        if (tokens.empty() || parseSymbolClass(tokens)) {
+            continue;
+        }
+
         if (numberOfTapes == 1) {
             // Transición monocinta: estado_actual símbolo_leído estado_siguiente símbolo_escrito dirección
             if (tokens.size() == 5) {
@@ -188,20 +223,24 @@ TuringMachine* MTParser::parseFile(const std::string& filename) {
     // Validar la máquina
     validateMachine(tm);
 
+    // Detectar máquinas reducibles a AFD
+    tm->compileDFA();
+
     return tm;
 }
 
 std::vector<std::string> MTParser::tokenize(const std::string& line) {
+    // Separación manual: con cientos de miles de transiciones un stringstream por línea domina la carga
     std::vector<std::string> tokens;
-    std::stringstream ss(line);
-    std::string token;
-
-    while (ss >> token) {
-        if (token[0] != '#') {  // Ignorar comentarios
-            tokens.push_back(token);
-        } else {
+    const char* blanks = " \t\r\n\v\f";
+    size_t start = line.find_first_not_of(blanks);
+    while (start != std::string::npos) {
+        if (line[start] == '#') {
             break;  // El resto de la línea es comentario
         }
+        size_t end = line.find_first_of(blanks, start);
+        tokens.emplace_back(line, start, end == std::string::npos ? std::string::npos : end - start);
+        start = line.find_first_not_of(blanks, end);
     }
 
     return tokens;
@@ -220,47 +259,47 @@ bool MTParser::isCommentOrEmpty(const std::string& line) {
     return trimmed.empty() || trimmed[0] == '#';
 }
 
+/**
+ * Valida la definición formal de la máquina
+ *
+ * Los nombres de estado y los símbolos de Γ se consultan en tablas hash
+ * construidas una vez, así que el coste es lineal en el número de
+ * transiciones. Las transiciones se comprueban por tramos en paralelo y se
+ * informa de todos los errores a la vez, en el orden de las transiciones.
+ */
 void MTParser::validateMachine(const TuringMachine* tm) {
     if (!tm) {
         throw MTException("La máquina de Turing es nula");
     }
 
+    std::vector<std::string> errors;
+
     // Validación 1: Verificar que la máquina tiene al menos un estado
     const auto& states = tm->getStates();
     if (states.empty()) {
-        throw MTException("La máquina debe tener al menos un estado");
+        errors.push_back("La máquina debe tener al menos un estado");
+    }
+    std::unordered_set<std::string> stateNames;
+    stateNames.reserve(states.size());
+    for (const auto& state : states) {
+        stateNames.insert(state.getName());
     }
 
     // Validación 2: Verificar que el estado inicial existe en Q
     const State& initialState = tm->getInitialState();
-    bool initialFound = false;
-    for (const auto& state : states) {
-        if (state.getName() == initialState.getName()) {
-            initialFound = true;
-            break;
-        }
-    }
-    if (!initialFound) {
-        throw MTException("El estado inicial '" + initialState.getName() + 
+    if (!states.empty() && stateNames.count(initialState.getName()) == 0) {
+        errors.push_back("El estado inicial '" + initialState.getName() +
                          "' no está en el conjunto de estados Q");
     }
 
     // Validación 3: Verificar que todos los estados de aceptación están en Q
     const auto& acceptanceStates = tm->getAcceptanceStates();
     if (acceptanceStates.empty()) {
-        throw MTException("La máquina debe tener al menos un estado de aceptación");
+        errors.push_back("La máquina debe tener al menos un estado de aceptación");
     }
-    
     for (const auto& acceptState : acceptanceStates) {
-        bool found = false;
-        for (const auto& state : states) {
-            if (state.getName() == acceptState.getName()) {
-                found = true;
-                break;
-            }
-        }
-        if (!found) {
-            throw MTException("El estado de aceptación '" + acceptState.getName() + 
+        if (stateNames.count(acceptState.getName()) == 0) {
+            errors.push_back("El estado de aceptación '" + acceptState.getName() +
                              "' no está en el conjunto de estados Q");
         }
     }
@@ -268,67 +307,190 @@ void MTParser::validateMachine(const TuringMachine* tm) {
     // Validación 4: Verificar que Σ ⊆ Γ (alfabeto entrada subconjunto de alfabeto cinta)
     const Alphabet& inputAlphabet = tm->getInputAlphabet();
     const Alphabet& tapeAlphabet = tm->getTapeAlphabet();
-    
+    const std::vector<std::string> tapeSymbolList = tapeAlphabet.getSymbols();
+    const std::unordered_set<std::string> tapeSymbols(tapeSymbolList.begin(), tapeSymbolList.end());
     for (const auto& symbol : inputAlphabet.getSymbols()) {
-        if (!tapeAlphabet.contains(symbol)) {
-            throw MTException("El símbolo '" + symbol + 
+        if (tapeSymbols.count(symbol) == 0) {
+            errors.push_back("El símbolo '" + symbol +
                              "' del alfabeto de entrada Σ no está en el alfabeto de cinta Γ");
         }
     }
 
     // Validación 5: Verificar que el símbolo blanco no está en Σ
-    const std::string& blankSymbol = tapeAlphabet.getBlankSymbol();
+    const std::string blankSymbol = tapeAlphabet.getBlankSymbol();
     if (inputAlphabet.contains(blankSymbol)) {
-        throw MTException("El símbolo blanco '" + blankSymbol + 
+        errors.push_back("El símbolo blanco '" + blankSymbol +
                          "' no puede estar en el alfabeto de entrada Σ");
     }
 
     // Validación 6: Verificar que el símbolo blanco está en Γ
-    if (!tapeAlphabet.contains(blankSymbol)) {
-        throw MTException("El símbolo blanco '" + blankSymbol + 
+    if (tapeSymbols.count(blankSymbol) == 0) {
+        errors.push_back("El símbolo blanco '" + blankSymbol +
                          "' debe estar en el alfabeto de cinta Γ");
     }
 
-    // Validación 7: Verificar transiciones
-    const auto& transitions = tm->getTransitions();
-    for (const auto& [key, trans] : transitions) {
-        // Verificar que los estados de la transición existen en Q
-        bool currentExists = false;
-        bool nextExists = false;
-        
-        for (const auto& state : states) {
-            if (state.getName() == trans.getCurrentState().getName()) {
-                currentExists = true;
+    // Validación 7: Verificar que los símbolos de las clases están en Γ
+    const auto& symbolClasses = tm->getSymbolClasses();
+    for (const auto& [name, members] : symbolClasses) {
+        for (const auto& symbol : members) {
+            if (tapeSymbols.count(symbol) == 0) {
+                errors.push_back("El símbolo '" + symbol + "' de la clase @" + name +
+                                 " no está en el alfabeto de cinta Γ");
             }
-            if (state.getName() == trans.getNextState().getName()) {
-                nextExists = true;
+        }
+    }
+
+    // Validación 8: Verificar transiciones (solo lectura de las tablas: se reparten entre hilos)
+    std::vector<const Transition*> transitions;
+    transitions.reserve(tm->getTransitions().size());
+    for (const auto& [key, trans] : tm->getTransitions()) {
+        transitions.push_back(&trans);
+    }
+    // El mapa está ordenado por (estado, símbolos): los errores se listan en el orden del archivo
+    std::sort(transitions.begin(), transitions.end(),
+              [](const Transition* a, const Transition* b) { return a->getId() < b->getId(); });
+
+    auto checkRange = [&](size_t begin, size_t end, std::vector<std::string>& found) {
+        for (size_t t = begin; t < end; t++) {
+            const Transition& trans = *transitions[t];
+
+            // Verificar que los estados de la transición existen en Q
+            if (stateNames.count(trans.getCurrentState().getName()) == 0) {
+                found.push_back("Estado '" + trans.getCurrentState().getName() +
+                                "' en transición no está en Q");
+            }
+            if (stateNames.count(trans.getNextState().getName()) == 0) {
+                found.push_back("Estado '" + trans.getNextState().getName() +
+                                "' en transición no está en Q");
+            }
+
+            // Verificar que los símbolos de todas las cintas están en Γ o son patrones válidos
+            const auto& readSymbols = trans.getReadSymbols();
+            const auto& writeSymbols = trans.getWriteSymbols();
+            for (size_t i = 0; i < readSymbols.size(); i++) {
+                const std::string& symbol = readSymbols[i];
+                if (tapeSymbols.count(symbol) != 0) {
+                    continue;
+                }
+                if (!SymbolPattern::isPattern(symbol, tapeAlphabet)) {
+                    found.push_back("Símbolo leído '" + symbol + "' en transición no está en Γ");
+                    continue;
+                }
+                const SymbolPattern read = SymbolPattern::parse(symbol, false, static_cast<int>(i), tapeAlphabet,
+                                                                symbolClasses);
+                if (read.kind == SymbolPattern::Kind::Class && read.members == nullptr) {
+                    found.push_back("Clase de símbolos '" + symbol + "' en transición no está definida");
+                } else if (read.kind == SymbolPattern::Kind::Tape &&
+                           (read.tape < 0 || read.tape >= static_cast<int>(i))) {
+                    found.push_back("Referencia '" + symbol + "' leída en la cinta " + std::to_string(i + 1) +
+                                    " debe ser a una cinta anterior");
+                }
+            }
+            for (size_t i = 0; i < writeSymbols.size(); i++) {
+                const std::string& symbol = writeSymbols[i];
+                if (tapeSymbols.count(symbol) != 0) {
+                    continue;
+                }
+                if (!SymbolPattern::isPattern(symbol, tapeAlphabet)) {
+                    found.push_back("Símbolo escrito '" + symbol + "' en transición no está en Γ");
+                    continue;
+                }
+                const SymbolPattern write = SymbolPattern::parse(symbol, true, static_cast<int>(i), tapeAlphabet,
+                                                                 symbolClasses);
+                if (write.kind == SymbolPattern::Kind::Class) {
+                    const SymbolPattern read = i < readSymbols.size()
+                        ? SymbolPattern::parse(readSymbols[i], false, static_cast<int>(i), tapeAlphabet,
+                                               symbolClasses)
+                        : SymbolPattern{SymbolPattern::Kind::Exact, "", nullptr, -1};
+                    if (write.members == nullptr) {
+                        found.push_back("Clase de símbolos '" + symbol + "' en transición no está definida");
+                    } else if (read.kind != SymbolPattern::Kind::Class || read.members == nullptr ||
+                               read.members->size() != write.members->size()) {
+                        found.push_back("La clase escrita '" + symbol + "' en la cinta " + std::to_string(i + 1) +
+                                        " requiere leer en esa cinta una clase del mismo tamaño");
+                    }
+                } else if (write.kind == SymbolPattern::Kind::Tape &&
+                           (write.tape < 0 || write.tape >= static_cast<int>(writeSymbols.size()))) {
+                    found.push_back("Referencia '" + symbol + "' en transición no es a una cinta de la máquina");
+                }
+            }
+
+            // Verificar que las direcciones son válidas
+            for (char dir : trans.getDirections()) {
+                if (dir != 'L' && dir != 'R' && dir != 'S') {
+                    found.push_back("Dirección '" + std::string(1, dir) +
+                                    "' en transición no es válida (debe ser L, R o S)");
+                }
             }
         }
-        
-        if (!currentExists) {
-            throw MTException("Estado '" + trans.getCurrentState().getName() + 
-                             "' en transición no está en Q");
+    };
+
+    const size_t threadCount = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()),
+                                                (transitions.size() + VALIDATION_CHUNK - 1) / VALIDATION_CHUNK);
+    if (threadCount <= 1) {
+        checkRange(0, transitions.size(), errors);
+    } else {
+        // Tramos contiguos por hilo: los errores se unen en el orden de las transiciones
+        std::vector<std::vector<std::string>> found(threadCount);
+        std::vector<std::thread> workers;
+        const size_t chunk = (transitions.size() + threadCount - 1) / threadCount;
+        for (size_t i = 0; i < threadCount; i++) {
+            const size_t begin = std::min(i * chunk, transitions.size());
+            const size_t end = std::min(begin + chunk, transitions.size());
+            workers.emplace_back(checkRange, begin, end, std::ref(found[i]));
         }
-        if (!nextExists) {
-            throw MTException("Estado '" + trans.getNextState().getName() + 
-                             "' en transición no está en Q");
+        for (size_t i = 0; i < threadCount; i++) {
+            workers[i].join();
+            errors.insert(errors.end(), found[i].begin(), found[i].end());
         }
+    }
 
-        // Verificar que los símbolos están en Γ
-        if (!tapeAlphabet.contains(trans.getReadSymbol())) {
-            throw MTException("Símbolo leído '" + trans.getReadSymbol() + 
-                             "' en transición no está en Γ");
+    // Validación 9: Limitar las transiciones concretas que generan los patrones
+    double expansion = 0;
+    for (const Transition* trans : transitions) {
+        if (!SymbolPattern::isPattern(*trans, tapeAlphabet)) {
+            continue;
         }
-        if (!tapeAlphabet.contains(trans.getWriteSymbol())) {
-            throw MTException("Símbolo escrito '" + trans.getWriteSymbol() + 
-                             "' en transición no está en Γ");
+        double combinations = 1;
+        const auto& readSymbols = trans->getReadSymbols();
+        for (size_t i = 0; i < readSymbols.size(); i++) {
+            const SymbolPattern read = SymbolPattern::parse(readSymbols[i], false, static_cast<int>(i),
+                                                            tapeAlphabet, symbolClasses);
+            if (read.kind == SymbolPattern::Kind::Any) {
+                combinations *= static_cast<double>(tapeSymbolList.size());
+            } else if (read.kind == SymbolPattern::Kind::Class && read.members != nullptr) {
+                combinations *= static_cast<double>(read.members->size());
+            }
         }
+        expansion += combinations;
+    }
+    if (expansion > MAX_PATTERN_EXPANSION) {
+        errors.push_back("Los patrones de las transiciones generan más de " +
+                         std::to_string(static_cast<long long>(MAX_PATTERN_EXPANSION)) +
+                         " transiciones concretas");
+    }
 
-        // Verificar que la dirección es válida
-        char dir = trans.getDirection();
-        if (dir != 'L' && dir != 'R' && dir != 'S') {
-            throw MTException("Dirección '" + std::string(1, dir) + 
-                             "' en transición no es válida (debe ser L, R o S)");
+    if (errors.empty()) {
+        return;
+    }
+    if (errors.size() == 1) {
+        throw MTException(errors.front());
+    }
+
+    // Un mismo error repetido en muchas transiciones se muestra una vez
+    std::unordered_set<std::string> seen;
+    std::string message = "se encontraron " + std::to_string(errors.size()) + " errores:";
+    size_t listed = 0;
+    for (const auto& error : errors) {
+        if (!seen.insert(error).second) {
+            continue;
+        }
+        if (listed == MAX_LISTED_ERRORS) {
+            message += "\n  ...";
+            break;
         }
+        message += "\n  - " + error;
+        listed++;
     }
+    throw MTException(message);
 }
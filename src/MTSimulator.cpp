@@ -1,12 +1,31 @@
 #include "../include/MTSimulator.h"
 #include "../include/MTParser.h"
+#include "../include/ProgressMonitor.h"
+#include "../include/LockstepEngine.h"
+#include "../include/InputSource.h"
+#include "../include/WorkerPool.h"
+#include "../include/TraceWriter.h"
+#include "../include/TransitionTable.h"
+#include "../include/ExecutionContext.h"
 #include <iostream>
+#include <algorithm>
 #include <iomanip>
+#include <chrono>
+
+namespace {
+
+double millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
 
 /**
  * Constructor de MTSimulator
  */
-MTSimulator::MTSimulator() : machine(nullptr) {
+MTSimulator::MTSimulator() : machine(nullptr), spillResidentPages(0), loadTimeMs(0.0), progress(nullptr),
+      traceWriter(nullptr), tapeWindow(0), tapeOutput(-1), divergenceCheck(false), nativePrimitives(true),
+      tracePolicy(TracePolicy::Full), countStates(false) {
 }
 
 /**
@@ -26,34 +45,446 @@ bool MTSimulator::loadMachine(const std::string& filename) {
         delete machine;
     }
 
+    auto start = std::chrono::steady_clock::now();
     machine = MTParser::parseFile(filename);
+    loadTimeMs = millisecondsSince(start);
+    machineFile = filename;
+    if (machine != nullptr) {
+        machine->setTapeSpill(spillResidentPages, spillDirectory);
+        machine->setResourceLimits(resourceLimits);
+        machine->setTapeWindow(tapeWindow);
+        machine->setDivergenceCheck(divergenceCheck);
+        machine->setNativePrimitives(nativePrimitives);
+    }
     return machine != nullptr;
 }
 
 /**
- * Ejecuta la máquina con una entrada específica
+ * Configura el volcado a disco de páginas frías de la cinta
+ */
+void MTSimulator::setTapeSpill(size_t maxResidentPages, const std::string& directory) {
+    spillResidentPages = maxResidentPages;
+    spillDirectory = directory;
+    if (machine != nullptr) {
+        machine->setTapeSpill(spillResidentPages, spillDirectory);
+    }
+}
+
+/**
+ * Establece el presupuesto de recursos de cada ejecución
+ */
+void MTSimulator::setResourceLimits(const ResourceLimits& limits) {
+    resourceLimits = limits;
+    if (machine != nullptr) {
+        machine->setResourceLimits(resourceLimits);
+    }
+}
+
+/**
+ * Limita la representación de la cinta a una ventana alrededor del cabezal
+ */
+void MTSimulator::setTapeWindow(long long radius) {
+    tapeWindow = radius;
+    if (machine != nullptr) {
+        machine->setTapeWindow(tapeWindow);
+    }
+}
+
+/**
+ * Activa o desactiva las primitivas nativas de cinta
+ */
+void MTSimulator::setNativePrimitives(bool enabled) {
+    nativePrimitives = enabled;
+    if (machine != nullptr) {
+        machine->setNativePrimitives(nativePrimitives);
+    }
+}
+
+/**
+ * Activa la detección de ciclos y ciclos trasladados
+ */
+void MTSimulator::setDivergenceCheck(bool enabled) {
+    divergenceCheck = enabled;
+    if (machine != nullptr) {
+        machine->setDivergenceCheck(divergenceCheck);
+    }
+}
+
+/**
+ * Vuelca las cintas finales a un descriptor
+ */
+void MTSimulator::setTapeOutput(int fd, const std::string& name) {
+    tapeOutput = fd;
+    tapeOutputName = name;
+}
+
+/**
+ * Asocia un monitor de progreso
+ */
+void MTSimulator::setProgressMonitor(ProgressMonitor* monitor) {
+    progress = monitor;
+}
+
+/**
+ * Asocia un escritor de traza
+ */
+void MTSimulator::setTraceWriter(TraceWriter* writer) {
+    traceWriter = writer;
+}
+
+/**
+ * Elige la traza de run()
+ */
+void MTSimulator::setTracePolicy(TracePolicy policy) {
+    tracePolicy = policy;
+}
+
+/**
+ * Activa el recuento de configuraciones por estado
  */
-bool MTSimulator::run(const std::string& input, int maxSteps) {
+void MTSimulator::setStateCounting(bool enabled) {
+    countStates = enabled;
+}
+
+bool MTSimulator::beginRun() {
     if (machine == nullptr) {
         std::cerr << "Error: No hay máquina cargada" << std::endl;
         return false;
     }
-
     executionTrace.clear();
-    
-    // Inicializar la máquina
+    if (progress != nullptr) {
+        progress->beginRun();
+    }
+    return true;
+}
+
+template <class Body>
+bool MTSimulator::observed(TracePolicy policy, Body body) {
+    if (traceWriter != nullptr) {
+        TraceWriterObserver trace(*traceWriter);
+        return counted(trace, body);
+    }
+    switch (policy) {
+        case TracePolicy::None: {
+            NoObserver none;
+            return counted(none, body);
+        }
+        case TracePolicy::Summary: {
+            SummaryObserver summary(executionTrace);
+            return counted(summary, body);
+        }
+        case TracePolicy::Full:
+        default: {
+            FullTraceObserver full(executionTrace);
+            return counted(full, body);
+        }
+    }
+}
+
+template <class Observer, class Body>
+bool MTSimulator::counted(Observer& observer, Body& body) {
+    if (!countStates) {
+        return body(observer);
+    }
+    ObserverPair<Observer, StateCounter> both(observer, stateCounter);
+    return body(both);
+}
+
+/**
+ * Ejecuta la máquina con una entrada específica
+ */
+bool MTSimulator::run(const std::string& input, long long maxSteps) {
+    return observed(tracePolicy, [&](auto& observer) { return run(input, maxSteps, observer); });
+}
+
+/**
+ * Ejecuta la máquina leyendo la entrada bajo demanda
+ */
+bool MTSimulator::run(InputSource& source, long long maxSteps) {
+    // La entrada no tiene tamaño conocido: no se guardan todas las configuraciones
+    const TracePolicy policy = tracePolicy == TracePolicy::Full ? TracePolicy::Summary : tracePolicy;
+    return observed(policy, [&](auto& observer) { return run(source, maxSteps, observer); });
+}
+
+/**
+ * Ejecuta la máquina imprimiendo la traza bajo demanda
+ */
+bool MTSimulator::runStreamed(const std::string& input, long long maxSteps, long long stride) {
+    TraceWriter writer(1, TraceFormat::Text);
+    writer.setStride(stride);
+    TraceWriterObserver observer(writer);
+    return run(input, maxSteps, observer);
+}
+
+ConfigurationStream MTSimulator::configurations(const std::string& input, long long maxSteps) {
     machine->initialize(input);
-    recordStep();  // Registrar estado inicial
+    return ConfigurationStream(*machine, maxSteps);
+}
+
+std::vector<PersistentRun> MTSimulator::recordHistory(const std::string& input, long long maxSteps,
+                                                      long long every) {
+    if (resourceLimits.maxSteps > 0) {
+        maxSteps = std::min(maxSteps, resourceLimits.maxSteps);
+    }
+    every = std::max(every, 1LL);
+
+    std::vector<PersistentRun> history;
+    PersistentRun current(*machine, input);
+    history.push_back(current);
+    while (current.getStepCount() < maxSteps && current.step()) {
+        if (current.getStepCount() % every == 0) {
+            history.push_back(current);  // Instantánea: solo se copian punteros
+        }
+    }
+    if (history.back().getStepCount() != current.getStepCount()) {
+        history.push_back(current);
+    }
+    return history;
+}
+
+void MTSimulator::printHistory(const std::string& input, long long maxSteps, long long every) {
+    if (machine == nullptr) {
+        std::cerr << "Error: No hay máquina cargada" << std::endl;
+        return;
+    }
+
+    std::vector<PersistentRun> history = recordHistory(input, maxSteps, every);
+    std::cout << "\n=== Historial (cada " << std::max(every, 1LL) << " pasos) ===" << std::endl;
+    for (const PersistentRun& config : history) {
+        std::cout << "Paso " << config.getStepCount() << ": " << config.getConfiguration() << std::endl;
+    }
+    const size_t chunks = PersistentRun::countChunks(history);
+    std::cout << "Configuraciones guardadas: " << history.size() << " (" << chunks << " trozos de cinta de "
+              << PersistentTape::CHUNK_SIZE << " celdas en total)" << std::endl;
+}
+
+void MTSimulator::finishRun(long long inputLength, std::chrono::steady_clock::time_point start) {
+    lastStats = RunStats();
+    lastStats.machineFile = machineFile;
+    lastStats.inputLength = inputLength;
+    lastStats.loadTimeMs = loadTimeMs;
+    lastStats.wallTimeMs = millisecondsSince(start);
+    lastStats.collect(*machine);
+}
+
+/**
+ * Ejecuta un lote de entradas con el motor por lanes
+ *
+ * Solo se usa sin límites de celdas ni de memoria (las lanes no pasan por
+ * el presupuesto de la cinta) y sin perfilador; el presupuesto de pasos se
+ * respeta igual que en TuringMachine::execute().
+ */
+bool MTSimulator::runLockstep(const std::vector<std::string>& inputs, long long maxSteps, bool verify) {
+    if (machine == nullptr) {
+        std::cerr << "Error: No hay máquina cargada" << std::endl;
+        return false;
+    }
+#ifdef MT_ENABLE_PROFILER
+    // El perfil mide el motor completo
+    const bool profiling = true;
+#else
+    const bool profiling = false;
+#endif
+    if (profiling || resourceLimits.maxTapeCells > 0 || resourceLimits.maxBytes > 0) {
+        return false;
+    }
+    LockstepEngine* engine = LockstepEngine::compile(*machine);
+    if (engine == nullptr) {
+        return false;
+    }
+
+    const bool stepLimited = resourceLimits.maxSteps > 0 && resourceLimits.maxSteps < maxSteps;
+    const long long limit = stepLimited ? resourceLimits.maxSteps : maxSteps;
+    std::vector<LockstepEngine::Result> results = engine->run(inputs, limit);
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        const LockstepEngine::Result& result = results[i];
+        const std::string& finalState = engine->getState(result.finalState).getName();
+        std::cout << "\n=================================================" << std::endl;
+        std::cout << "Ejecutando con entrada: \"" << inputs[i] << "\"" << std::endl;
+        std::cout << "\n=== Resultado ===" << std::endl;
+        std::cout << "Pasos totales: " << result.steps << std::endl;
+        // Con --max-steps el motor completo se detiene con exceededLimits()
+        const bool limited = stepLimited && !result.halted && result.steps == limit;
+        if (limited) {
+            std::cout << "Resultado: LÍMITE DE RECURSOS (pasos (" << limit << "))" << std::endl;
+        } else {
+            std::cout << "Resultado: " << (result.accepted ? "ACEPTA" : "RECHAZA") << std::endl;
+        }
+        std::cout << "Cinta final: [" << result.tape << "]" << std::endl;
+        std::cout << "Estado final: " << finalState << std::endl;
+
+        if (verify) {
+            machine->execute(inputs[i], maxSteps);
+            const bool halted = machine->isHalted() && !machine->exceededLimits();
+            if (machine->wasAccepted() != result.accepted || machine->exceededLimits() != limited ||
+                halted != result.halted ||
+                machine->getStepCount() != result.steps || machine->getCurrentState().getName() != finalState ||
+                machine->getTapeContent() != result.tape || machine->getHeadPosition() != result.headPosition) {
+                mismatches++;
+                std::cout << "Comprobación: DISCREPANCIA con el motor completo (" << machine->getStepCount()
+                          << " pasos, estado " << machine->getCurrentState().getName() << ", cinta ["
+                          << machine->getTapeContent() << "], cabezal " << machine->getHeadPosition() << ")" << std::endl;
+            } else {
+                std::cout << "Comprobación: OK" << std::endl;
+            }
+        }
+        std::cout << "=================================================\n" << std::endl;
+    }
+    if (verify) {
+        std::cout << "Comprobación lockstep: " << inputs.size() << " entradas, " << mismatches
+                  << " discrepancias" << std::endl;
+    }
+
+    delete engine;
+    return true;
+}
+
+/**
+ * Comprueba la última ejecución contra el motor paso a paso
+ *
+ * La referencia es una copia de la máquina (misma configuración) sin
+ * primitivas nativas ni AFD: un executeStep() por paso.
+ */
+bool MTSimulator::checkPrimitives(const std::string& input, long long maxSteps) {
+    if (machine == nullptr) {
+        return false;
+    }
+    TuringMachine reference(*machine);
+    reference.setNativePrimitives(false);
+    reference.initialize(input);
+    for (long long i = 0; i < maxSteps && reference.executeStep(); i++) {
+    }
 
-    // Ejecutar paso a paso y registrar cada paso
-    for (int i = 0; i < maxSteps && !machine->isHalted(); i++) {
-        if (!machine->executeStep()) {
-            break;
+    std::string difference;
+    auto compare = [&](const std::string& what, const std::string& expected, const std::string& actual) {
+        if (difference.empty() && expected != actual) {
+            difference = what + " " + expected + " en lugar de " + actual;
         }
-        recordStep();  // Registrar después de cada paso
+    };
+    compare("pasos", std::to_string(reference.getStepCount()), std::to_string(machine->getStepCount()));
+    compare("búsquedas", std::to_string(reference.getTransitionLookups()),
+            std::to_string(machine->getTransitionLookups()));
+    compare("estado", reference.getCurrentState().getName(), machine->getCurrentState().getName());
+    auto verdict = [](const TuringMachine& tm) -> std::string {
+        if (tm.exceededLimits()) {
+            return "LÍMITE DE RECURSOS";
+        }
+        if (tm.hasDiverged()) {
+            return "DIVERGE";
+        }
+        return tm.wasAccepted() ? "ACEPTA" : (tm.isHalted() ? "RECHAZA" : "SIN TERMINAR");
+    };
+    compare("resultado", verdict(reference), verdict(*machine));
+    for (int i = 0; i < machine->getNumberOfTapes(); i++) {
+        const std::string tape = "cinta " + std::to_string(i + 1);
+        compare(tape, "[" + reference.getTapeContent(i) + "]", "[" + machine->getTapeContent(i) + "]");
+        compare("cabezal de la " + tape, std::to_string(reference.getHeadPosition(i)),
+                std::to_string(machine->getHeadPosition(i)));
+        compare("celdas alcanzadas de la " + tape, std::to_string(reference.getTape(i)->getCellsReached()),
+                std::to_string(machine->getTape(i)->getCellsReached()));
+    }
+
+    if (difference.empty()) {
+        std::cout << "Comprobación de primitivas: OK" << std::endl;
+        return true;
+    }
+    std::cout << "Comprobación de primitivas: DISCREPANCIA con el motor paso a paso (" << difference << ")"
+              << std::endl;
+    return false;
+}
+
+/**
+ * Ejecuta un lote de entradas con el planificador por porciones
+ *
+ * Las ejecuciones cortas terminan enseguida aunque haya otras largas en
+ * marcha; los resultados se imprimen en el orden de las entradas.
+ */
+void MTSimulator::runScheduled(const std::vector<std::string>& inputs, long long maxSteps, int workers,
+                               long long sliceSteps, SchedulingPolicy policy) {
+    if (machine == nullptr) {
+        std::cerr << "Error: No hay máquina cargada" << std::endl;
+        return;
+    }
+
+    // Un solo programa compilado para todas las ejecuciones; cada una solo tiene su contexto
+    std::shared_ptr<const MachineProgram> program = MachineProgram::compile(*machine);
+    RunScheduler scheduler(workers, sliceSteps, policy);
+    std::vector<RunScheduler::Handle> handles;
+    for (const std::string& input : inputs) {
+        ExecutionContext* context = new ExecutionContext(program);
+        context->setTapeSpill(spillResidentPages, spillDirectory);
+        context->setResourceLimits(resourceLimits);
+        context->setDivergenceCheck(divergenceCheck);
+        context->setNativePrimitives(nativePrimitives);
+        handles.push_back(scheduler.submit(context, input, maxSteps));
+    }
+
+    for (size_t i = 0; i < inputs.size(); i++) {
+        const ScheduledResult& result = handles[i].get();
+        std::cout << "\n=================================================" << std::endl;
+        std::cout << "Ejecutando con entrada: \"" << inputs[i] << "\"" << std::endl;
+        std::cout << "\n=== Resultado ===" << std::endl;
+        std::cout << "Pasos totales: " << result.steps << " (" << result.slices << " porciones)" << std::endl;
+        if (result.limitExceeded) {
+            std::cout << "Resultado: LÍMITE DE RECURSOS (" << result.limitReason << ")" << std::endl;
+        } else if (!result.divergence.empty()) {
+            std::cout << "Resultado: DIVERGE (" << result.divergence << ")" << std::endl;
+        } else {
+            std::cout << "Resultado: " << (result.accepted ? "ACEPTA" : "RECHAZA") << std::endl;
+        }
+        printFinalTapes(result.tapes);
+        std::cout << "Estado final: " << result.finalState << std::endl;
+        std::cout << "=================================================\n" << std::endl;
+    }
+}
+
+/**
+ * Ejecuta un lote de entradas en procesos trabajadores
+ *
+ * La máquina se carga una sola vez aquí; si un trabajador muere con una
+ * entrada, esa entrada se indica como fallida y las demás siguen.
+ */
+bool MTSimulator::runProcesses(const std::vector<std::string>& inputs, long long maxSteps, int processes) {
+    if (machine == nullptr) {
+        std::cerr << "Error: No hay máquina cargada" << std::endl;
+        return false;
+    }
+    if (!WorkerPool::isSupported()) {
+        return false;
     }
 
-    return machine->wasAccepted();
+    WorkerPool pool(*machine, processes);
+    std::vector<PoolResult> results = pool.run(inputs, maxSteps);
+
+    size_t failures = 0;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        const PoolResult& result = results[i];
+        std::cout << "\n=================================================" << std::endl;
+        std::cout << "Ejecutando con entrada: \"" << inputs[i] << "\"" << std::endl;
+        std::cout << "\n=== Resultado ===" << std::endl;
+        if (!result.completed) {
+            failures++;
+            std::cout << "Resultado: ERROR (" << result.error << ")" << std::endl;
+            std::cout << "=================================================\n" << std::endl;
+            continue;
+        }
+        std::cout << "Pasos totales: " << result.steps << std::endl;
+        if (result.limitExceeded) {
+            std::cout << "Resultado: LÍMITE DE RECURSOS (" << result.limitReason << ")" << std::endl;
+        } else if (!result.divergence.empty()) {
+            std::cout << "Resultado: DIVERGE (" << result.divergence << ")" << std::endl;
+        } else {
+            std::cout << "Resultado: " << (result.accepted ? "ACEPTA" : "RECHAZA") << std::endl;
+        }
+        printFinalTapes(result.tapes);
+        std::cout << "Estado final: " << result.finalState << std::endl;
+        std::cout << "=================================================\n" << std::endl;
+    }
+    std::cout << "Procesos trabajadores: " << pool.getProcessCount() << ", " << inputs.size() << " entradas, "
+              << failures << " fallidas" << std::endl;
+    return true;
 }
 
 /**
@@ -76,6 +507,13 @@ const std::vector<std::string>& MTSimulator::getExecutionTrace() const {
     return executionTrace;
 }
 
+/**
+ * Estadísticas de la última ejecución
+ */
+const RunStats& MTSimulator::getLastStats() const {
+    return lastStats;
+}
+
 /**
  * Imprime el estado actual
  */
@@ -96,7 +534,10 @@ void MTSimulator::printCurrentState() const {
 void MTSimulator::printExecutionTrace() const {
     std::cout << "\n=== Traza de Ejecución ===" << std::endl;
     for (size_t i = 0; i < executionTrace.size(); i++) {
-        std::cout << "Paso " << i << ": " << executionTrace[i] << std::endl;
+        // Con entrada leída bajo demanda la traza solo tiene el estado inicial y el final
+        const long long step = (i > 0 && i + 1 == executionTrace.size()) ? machine->getStepCount()
+                                                                          : static_cast<long long>(i);
+        std::cout << "Paso " << step << ": " << executionTrace[i] << std::endl;
     }
 }
 
@@ -108,7 +549,7 @@ void MTSimulator::printSummaryTrace() const {
     if (!executionTrace.empty()) {
         std::cout << "Paso 0 (inicial): " << executionTrace.front() << std::endl;
         if (executionTrace.size() > 1) {
-            std::cout << "Paso " << (executionTrace.size() - 1) << " (final): " << executionTrace.back() << std::endl;
+            std::cout << "Paso " << machine->getStepCount() << " (final): " << executionTrace.back() << std::endl;
         }
     }
 }
@@ -124,20 +565,63 @@ void MTSimulator::printResult() const {
 
     std::cout << "\n=== Resultado ===" << std::endl;
     std::cout << "Pasos totales: " << machine->getStepCount() << std::endl;
-    std::cout << "Resultado: " << (machine->wasAccepted() ? "ACEPTA" : "RECHAZA") << std::endl;
+    if (machine->exceededLimits()) {
+        std::cout << "Resultado: LÍMITE DE RECURSOS (" << machine->getLimitReason() << ")" << std::endl;
+    } else if (machine->hasDiverged()) {
+        std::cout << "Resultado: DIVERGE (" << machine->getDivergenceReason() << ")" << std::endl;
+    } else {
+        std::cout << "Resultado: " << (machine->wasAccepted() ? "ACEPTA" : "RECHAZA") << std::endl;
+    }
     
     if (machine->isMultiTape()) {
         std::cout << "Cintas finales:" << std::endl;
         for (int i = 0; i < machine->getNumberOfTapes(); i++) {
-            std::cout << "  Cinta " << (i + 1) << ": [" << machine->getTapeContent(i) << "]" << std::endl;
+            std::cout << "  Cinta " << (i + 1) << ": ";
+            printTapeContent(i);
         }
     } else {
-        std::cout << "Cinta final: [" << machine->getTapeContent() << "]" << std::endl;
+        std::cout << "Cinta final: ";
+        printTapeContent(0);
     }
     
     std::cout << "Estado final: " << machine->getCurrentState().getName() << std::endl;
 }
 
+/**
+ * Imprime las configuraciones de cada estado
+ */
+void MTSimulator::printStateCounts() {
+    if (machine == nullptr) {
+        std::cout << "No hay máquina cargada" << std::endl;
+        return;
+    }
+
+    std::cout << "\n=== Configuraciones por estado ===" << std::endl;
+    const TransitionTable& program = machine->getProgram();
+    const std::vector<long long>& visits = stateCounter.getVisits();
+    for (size_t i = 0; i < visits.size(); i++) {
+        if (visits[i] > 0) {
+            std::cout << "  " << program.getState(static_cast<int>(i)).getName() << ": " << visits[i] << std::endl;
+        }
+    }
+}
+
+/**
+ * Imprime el perfil de la última ejecución
+ */
+void MTSimulator::printProfile() const {
+    if (machine == nullptr) {
+        std::cout << "No hay máquina cargada" << std::endl;
+        return;
+    }
+
+#ifdef MT_ENABLE_PROFILER
+    std::cout << machine->getProfiler().report(*machine);
+#else
+    std::cout << "\nPerfil no disponible: compilar con -DMT_ENABLE_PROFILER=ON" << std::endl;
+#endif
+}
+
 /**
  * Imprime información de la máquina
  */
@@ -150,6 +634,36 @@ void MTSimulator::printMachineInfo() const {
     std::cout << machine->toString();
 }
 
+void MTSimulator::printFinalTapes(const std::vector<std::string>& tapes) {
+    if (tapes.size() > 1) {
+        std::cout << "Cintas finales:" << std::endl;
+        for (size_t i = 0; i < tapes.size(); i++) {
+            std::cout << "  Cinta " << (i + 1) << ": [" << tapes[i] << "]" << std::endl;
+        }
+    } else {
+        std::cout << "Cinta final: [" << (tapes.empty() ? std::string() : tapes[0]) << "]" << std::endl;
+    }
+}
+
+void MTSimulator::printTapeContent(int tapeIndex) const {
+    const long long releasedEnd = machine->getTape(tapeIndex)->getReleasedEnd();
+    if (releasedEnd > 0) {
+        // La entrada leída bajo demanda ya no está en memoria: que no parezca la cinta completa
+        std::cout << "(truncada: las celdas anteriores a la " << releasedEnd
+                  << " se liberaron al leer la entrada) ";
+    }
+    if (tapeOutput < 0) {
+        std::cout << "[" << machine->getTapeContent(tapeIndex) << "]" << std::endl;
+    } else if (tapeOutput == 1) {
+        // Misma salida que sin volcado, pero sin pasar por una cadena intermedia
+        std::cout << "[" << std::flush;
+        machine->writeTapeContent(tapeIndex, tapeOutput, "]\n");
+    } else {
+        long long written = machine->writeTapeContent(tapeIndex, tapeOutput, "\n");
+        std::cout << "escrita en " << tapeOutputName << " (" << (written - 1) << " bytes)" << std::endl;
+    }
+}
+
 void MTSimulator::recordStep() {
     if (machine == nullptr) return;
 
@@ -161,8 +675,11 @@ std::string MTSimulator::visualizeTape() const {
     if (machine == nullptr) return "";
 
     std::string visualization = "Cinta: ";
+    if (tapeWindow > 0) {
+        return visualization + "[" + machine->getTapeWindow(0, true) + "]";
+    }
     std::string content = machine->getTapeContent();
-    int headPos = machine->getHeadPosition();
+    long long headPos = machine->getHeadPosition();
 
     visualization += "[";
     for (int i = 0; i < (int)content.size(); i++) {
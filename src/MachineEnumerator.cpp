@@ -0,0 +1,409 @@
+#include "../include/MachineEnumerator.h"
+#include "../include/MTException.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+// Celdas de cinta de cada candidata: salir de ellas la deja indecisa
+const long long MAX_TAPE = 1 << 16;
+
+// Subárboles por hilo al repartir el trabajo
+const size_t TASKS_PER_THREAD = 16;
+
+enum class Outcome { Halted, Cycled, Undecided, Branch };
+
+/**
+ * Candidata a medio definir con la configuración en la que se detuvo
+ *
+ * Fuera de [lo, hi] la cinta (y la instantánea) está en blanco, de modo que
+ * copiar un nodo solo cuesta la parte escrita.
+ */
+struct Node {
+    EnumeratedMachine machine;
+    int usedStates;
+    int usedSymbols;
+
+    int state;
+    long long head;
+    long long steps;
+    long long lo, hi;               // Celdas escritas
+    std::vector<uint8_t> tape;
+
+    // Instantánea en los pasos potencia de 2 para detectar ciclos exactos
+    int snapState;
+    long long snapHead;
+    long long snapLo, snapHi;
+    long long nextSnapshot;
+    std::vector<uint8_t> snapTape;
+
+    Node(int states, int symbols, long long tapeSize)
+        : machine(states, symbols), usedStates(1), usedSymbols(1), state(0), head(tapeSize / 2), steps(0),
+          lo(tapeSize / 2), hi(tapeSize / 2), tape(static_cast<size_t>(tapeSize), 0), snapState(-1),
+          snapHead(-1), snapLo(tapeSize / 2), snapHi(tapeSize / 2), nextSnapshot(1),
+          snapTape(static_cast<size_t>(tapeSize), 0) {}
+
+    /**
+     * Copia el nodo padre reutilizando la memoria de este
+     */
+    void assign(const Node& parent) {
+        machine.write = parent.machine.write;
+        machine.move = parent.machine.move;
+        machine.next = parent.machine.next;
+        usedStates = parent.usedStates;
+        usedSymbols = parent.usedSymbols;
+        state = parent.state;
+        head = parent.head;
+        steps = parent.steps;
+        copyRange(tape, lo, hi, parent.tape, parent.lo, parent.hi);
+        lo = parent.lo;
+        hi = parent.hi;
+        snapState = parent.snapState;
+        snapHead = parent.snapHead;
+        copyRange(snapTape, snapLo, snapHi, parent.snapTape, parent.snapLo, parent.snapHi);
+        snapLo = parent.snapLo;
+        snapHi = parent.snapHi;
+        nextSnapshot = parent.nextSnapshot;
+    }
+
+    static void copyRange(std::vector<uint8_t>& target, long long targetLo, long long targetHi,
+                          const std::vector<uint8_t>& source, long long sourceLo, long long sourceHi) {
+        std::memset(&target[targetLo], 0, static_cast<size_t>(targetHi - targetLo + 1));
+        std::memcpy(&target[sourceLo], &source[sourceLo], static_cast<size_t>(sourceHi - sourceLo + 1));
+    }
+
+    long long countNonBlank() const {
+        long long count = 0;
+        for (long long i = lo; i <= hi; i++) {
+            count += tape[i] != 0;
+        }
+        return count;
+    }
+};
+
+/**
+ * Recuento de un hilo
+ */
+struct Tally {
+    long long machines = 0;
+    long long halted = 0;
+    long long cycled = 0;
+    long long undecided = 0;
+    std::vector<EnumerationResult> longest;
+};
+
+void keepLongest(std::vector<EnumerationResult>& longest, size_t top, const EnumerationResult& result) {
+    if (top == 0 || (longest.size() == top && longest.back().steps >= result.steps)) {
+        return;
+    }
+    auto position = std::upper_bound(longest.begin(), longest.end(), result,
+        [](const EnumerationResult& a, const EnumerationResult& b) { return a.steps > b.steps; });
+    longest.insert(position, result);
+    if (longest.size() > top) {
+        longest.pop_back();
+    }
+}
+
+/**
+ * Recorrido del árbol compartido por el reparto inicial y los hilos
+ */
+class Search {
+private:
+    const EnumerationOptions& options;
+    const long long tapeSize;
+    const MachineEnumerator::HaltHandler& onHalt;
+    std::mutex& haltMutex;
+
+public:
+    Search(const EnumerationOptions& opts, long long tape, const MachineEnumerator::HaltHandler& handler,
+           std::mutex& mutex)
+        : options(opts), tapeSize(tape), onHalt(handler), haltMutex(mutex) {}
+
+    long long getTapeSize() const { return tapeSize; }
+
+    /**
+     * Ejecuta la candidata hasta parar, repetir una configuración, agotar el
+     * presupuesto o llegar a una transición sin definir
+     */
+    Outcome simulate(Node& node) const {
+        const EnumeratedMachine& tm = node.machine;
+        const int symbols = tm.symbols;
+        uint8_t* tape = node.tape.data();
+        for (;;) {
+            if (node.steps >= options.maxSteps) {
+                return Outcome::Undecided;
+            }
+            const size_t index = static_cast<size_t>(node.state) * symbols + tape[node.head];
+            const uint8_t next = tm.next[index];
+            if (next == EnumeratedMachine::UNDEFINED) {
+                return Outcome::Branch;
+            }
+
+            tape[node.head] = tm.write[index];
+            node.lo = std::min(node.lo, node.head);
+            node.hi = std::max(node.hi, node.head);
+            node.head += tm.move[index] ? 1 : -1;
+            node.steps++;
+            if (next == EnumeratedMachine::HALT) {
+                return Outcome::Halted;
+            }
+            node.state = next;
+            if (node.head < 0 || node.head >= tapeSize) {
+                return Outcome::Undecided;
+            }
+
+            if (node.state == node.snapState && node.head == node.snapHead && sameTape(node)) {
+                return Outcome::Cycled;
+            }
+            if (node.steps == node.nextSnapshot) {
+                Node::copyRange(node.snapTape, node.snapLo, node.snapHi, node.tape, node.lo, node.hi);
+                node.snapLo = node.lo;
+                node.snapHi = node.hi;
+                node.snapState = node.state;
+                node.snapHead = node.head;
+                node.nextSnapshot *= 2;
+            }
+        }
+    }
+
+    /**
+     * Llama a f(escrito, movimiento, siguiente) con cada opción en forma normal
+     * para la transición sin definir en la que se detuvo el nodo
+     */
+    template <typename F>
+    void forEachOption(const Node& node, F f) const {
+        const int stateLimit = std::min(node.usedStates + 1, options.states);
+        const int symbolLimit = std::min(node.usedSymbols + 1, options.symbols);
+        const int firstMove = node.steps == 0 ? 1 : 0;  // El primer movimiento, siempre a la derecha
+        for (int next = 0; next < stateLimit; next++) {
+            for (int write = 0; write < symbolLimit; write++) {
+                for (int move = firstMove; move <= 1; move++) {
+                    f(static_cast<uint8_t>(write), static_cast<uint8_t>(move), static_cast<uint8_t>(next));
+                }
+            }
+        }
+        // Una sola forma de parar: el resto de opciones de parada son equivalentes
+        f(static_cast<uint8_t>(1), static_cast<uint8_t>(1), EnumeratedMachine::HALT);
+    }
+
+    /**
+     * Define en el hijo la transición pendiente del padre
+     */
+    void define(Node& child, const Node& parent, uint8_t write, uint8_t move, uint8_t next) const {
+        const size_t index = static_cast<size_t>(parent.state) * options.symbols + parent.tape[parent.head];
+        child.machine.write[index] = write;
+        child.machine.move[index] = move;
+        child.machine.next[index] = next;
+        if (next != EnumeratedMachine::HALT && next == parent.usedStates) {
+            child.usedStates++;
+        }
+        if (write == parent.usedSymbols) {
+            child.usedSymbols++;
+        }
+    }
+
+    /**
+     * Registra una hoja del árbol
+     */
+    void classify(Node& node, Outcome outcome, Tally& tally) const {
+        tally.machines++;
+        if (outcome == Outcome::Cycled) {
+            tally.cycled++;
+            return;
+        }
+        if (outcome == Outcome::Undecided) {
+            tally.undecided++;
+            return;
+        }
+        tally.halted++;
+        const bool kept = tally.longest.size() < options.top ||
+                          (!tally.longest.empty() && tally.longest.back().steps < node.steps);
+        if (!kept && !onHalt) {
+            return;
+        }
+        EnumerationResult result;
+        result.machine = node.machine;
+        result.steps = node.steps;
+        result.nonBlank = node.countNonBlank();
+        if (kept) {
+            keepLongest(tally.longest, options.top, result);
+        }
+        if (onHalt) {
+            std::lock_guard<std::mutex> lock(haltMutex);
+            onHalt(result);
+        }
+    }
+
+    /**
+     * Recorre en profundidad el subárbol de stack[depth]
+     * Cada nivel define una transición más, así que la pila tiene estados x símbolos + 1 nodos
+     */
+    void explore(std::vector<std::unique_ptr<Node>>& stack, size_t depth, Tally& tally) const {
+        Node& node = *stack[depth];
+        const Outcome outcome = simulate(node);
+        if (outcome != Outcome::Branch) {
+            classify(node, outcome, tally);
+            return;
+        }
+        forEachOption(node, [&](uint8_t write, uint8_t move, uint8_t next) {
+            Node& child = *stack[depth + 1];
+            child.assign(node);
+            define(child, node, write, move, next);
+            explore(stack, depth + 1, tally);
+        });
+    }
+
+private:
+    bool sameTape(const Node& node) const {
+        const long long from = std::min(node.lo, node.snapLo);
+        const long long to = std::max(node.hi, node.snapHi);
+        return std::memcmp(&node.tape[from], &node.snapTape[from], static_cast<size_t>(to - from + 1)) == 0;
+    }
+};
+
+}  // namespace
+
+EnumeratedMachine::EnumeratedMachine(int stateCount, int symbolCount)
+    : states(stateCount), symbols(symbolCount),
+      write(static_cast<size_t>(stateCount * symbolCount), 0),
+      move(static_cast<size_t>(stateCount * symbolCount), 0),
+      next(static_cast<size_t>(stateCount * symbolCount), UNDEFINED) {}
+
+std::string EnumeratedMachine::toString() const {
+    std::string text;
+    for (int s = 0; s < states; s++) {
+        if (s > 0) {
+            text += '_';
+        }
+        for (int c = 0; c < symbols; c++) {
+            const size_t index = static_cast<size_t>(s) * symbols + c;
+            if (next[index] == UNDEFINED) {
+                text += "---";
+                continue;
+            }
+            text += static_cast<char>('0' + write[index]);
+            text += move[index] ? 'R' : 'L';
+            text += next[index] == HALT ? 'Z' : static_cast<char>('A' + next[index]);
+        }
+    }
+    return text;
+}
+
+std::string EnumeratedMachine::toMachineFile() const {
+    std::string text = "# Máquina enumerada " + toString() + "\n";
+    for (int s = 0; s < states; s++) {
+        text += "q" + std::to_string(s) + " ";
+    }
+    text += "qH\n";
+    for (int c = 1; c < symbols; c++) {
+        text += std::to_string(c) + (c + 1 < symbols ? " " : "\n");
+    }
+    for (int c = 0; c < symbols; c++) {
+        text += std::to_string(c) + (c + 1 < symbols ? " " : "\n");
+    }
+    text += "q0\n0\nqH\n";
+    for (int s = 0; s < states; s++) {
+        for (int c = 0; c < symbols; c++) {
+            const size_t index = static_cast<size_t>(s) * symbols + c;
+            if (next[index] == UNDEFINED) {
+                continue;
+            }
+            const std::string target = next[index] == HALT ? "qH" : "q" + std::to_string(next[index]);
+            text += "q" + std::to_string(s) + " " + std::to_string(c) + " " + target + " " +
+                    std::to_string(write[index]) + " " + (move[index] ? "R" : "L") + "\n";
+        }
+    }
+    return text;
+}
+
+MachineEnumerator::MachineEnumerator(const EnumerationOptions& opts) : options(opts) {
+    if (options.states < 1 || options.states > MAX_STATES) {
+        throw MTException("El número de estados debe estar entre 1 y " + std::to_string(MAX_STATES));
+    }
+    if (options.symbols < 2 || options.symbols > MAX_SYMBOLS) {
+        throw MTException("El número de símbolos debe estar entre 2 y " + std::to_string(MAX_SYMBOLS));
+    }
+    if (options.maxSteps < 1) {
+        throw MTException("El límite de pasos debe ser positivo");
+    }
+}
+
+EnumerationSummary MachineEnumerator::run(const HaltHandler& onHalt) const {
+    auto start = std::chrono::steady_clock::now();
+    const long long tapeSize = std::min(2 * options.maxSteps + 3, MAX_TAPE);
+    std::mutex haltMutex;
+    Search search(options, tapeSize, onHalt, haltMutex);
+
+    int threadCount = options.threads;
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+
+    // Reparto: abrir el árbol en anchura hasta tener subárboles para todos los hilos
+    Tally rootTally;
+    std::deque<std::unique_ptr<Node>> frontier;
+    frontier.push_back(std::unique_ptr<Node>(new Node(options.states, options.symbols, tapeSize)));
+    std::vector<std::unique_ptr<Node>> tasks;
+    const size_t wanted = static_cast<size_t>(threadCount) * TASKS_PER_THREAD;
+    while (!frontier.empty() && frontier.size() + tasks.size() < wanted) {
+        std::unique_ptr<Node> node = std::move(frontier.front());
+        frontier.pop_front();
+        const Outcome outcome = search.simulate(*node);
+        if (outcome != Outcome::Branch) {
+            search.classify(*node, outcome, rootTally);
+            continue;
+        }
+        search.forEachOption(*node, [&](uint8_t write, uint8_t move, uint8_t next) {
+            std::unique_ptr<Node> child(new Node(options.states, options.symbols, tapeSize));
+            child->assign(*node);
+            search.define(*child, *node, write, move, next);
+            frontier.push_back(std::move(child));
+        });
+    }
+    for (auto& node : frontier) {
+        tasks.push_back(std::move(node));
+    }
+
+    // Cada hilo recorre en profundidad los subárboles que va tomando
+    const size_t depth = static_cast<size_t>(options.states * options.symbols) + 1;
+    std::vector<Tally> tallies(static_cast<size_t>(threadCount));
+    std::atomic<size_t> nextTask(0);
+    auto worker = [&](Tally& tally) {
+        std::vector<std::unique_ptr<Node>> stack;
+        for (size_t i = 0; i < depth; i++) {
+            stack.emplace_back(new Node(options.states, options.symbols, tapeSize));
+        }
+        for (size_t task = nextTask++; task < tasks.size(); task = nextTask++) {
+            stack[0]->assign(*tasks[task]);
+            search.explore(stack, 0, tally);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int i = 1; i < threadCount; i++) {
+        threads.emplace_back(worker, std::ref(tallies[static_cast<size_t>(i)]));
+    }
+    worker(tallies[0]);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    EnumerationSummary summary;
+    tallies.push_back(std::move(rootTally));
+    for (const Tally& tally : tallies) {
+        summary.machines += tally.machines;
+        summary.halted += tally.halted;
+        summary.cycled += tally.cycled;
+        summary.undecided += tally.undecided;
+        for (const EnumerationResult& result : tally.longest) {
+            keepLongest(summary.longest, options.top, result);
+        }
+    }
+    summary.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return summary;
+}
@@ -0,0 +1,10 @@
+#include "../include/MachineProgram.h"
+#include "../include/TransitionTable.h"
+
+MachineProgram::MachineProgram(const TuringMachine& tm) : definition(tm), table(&definition.getProgram()) {
+}
+
+std::shared_ptr<const MachineProgram> MachineProgram::compile(const TuringMachine& tm) {
+    // El constructor es privado: make_shared no puede usarlo
+    return std::shared_ptr<const MachineProgram>(new MachineProgram(tm));
+}
@@ -0,0 +1,58 @@
+#include "../include/PageArena.h"
+#include <cstring>
+
+namespace {
+
+// Páginas por bloque reservado
+const size_t PAGES_PER_BLOCK = 16;
+
+}  // namespace
+
+PageArena::PageArena(size_t pageBytes) : pageSize(pageBytes) {
+    blankPages.fill(nullptr);
+}
+
+PageArena::~PageArena() {
+    for (uint8_t* block : blocks) {
+        delete[] block;
+    }
+    for (uint8_t* page : blankPages) {
+        delete[] page;
+    }
+}
+
+uint8_t* PageArena::allocate() {
+    if (freePages.empty()) {
+        grow();
+    }
+    uint8_t* page = freePages.back();
+    freePages.pop_back();
+    return page;
+}
+
+void PageArena::release(uint8_t* page) {
+    freePages.push_back(page);
+}
+
+const uint8_t* PageArena::blankPage(uint8_t blankCode) {
+    if (blankPages[blankCode] == nullptr) {
+        blankPages[blankCode] = new uint8_t[pageSize];
+        std::memset(blankPages[blankCode], blankCode, pageSize);
+    }
+    return blankPages[blankCode];
+}
+
+size_t PageArena::getReservedPages() const {
+    return blocks.size() * PAGES_PER_BLOCK;
+}
+
+void PageArena::grow() {
+    uint8_t* block = new uint8_t[pageSize * PAGES_PER_BLOCK];
+    blocks.push_back(block);
+    // Capacidad para todas las páginas: release() nunca tiene que ampliar el vector
+    freePages.reserve(getReservedPages());
+    // En orden inverso para entregar primero las de dirección más baja
+    for (size_t i = PAGES_PER_BLOCK; i-- > 0;) {
+        freePages.push_back(block + i * pageSize);
+    }
+}
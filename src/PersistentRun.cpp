@@ -0,0 +1,90 @@
+#include "../include/PersistentRun.h"
+#include "../include/TuringMachine.h"
+#include "../include/TransitionTable.h"
+#include <unordered_set>
+
+PersistentRun::PersistentRun(TuringMachine& tm, const std::string& input)
+    : program(&tm.getProgram()), alphabet(&tm.getTapeAlphabet()),
+      readBuffer(tm.getNumberOfTapes(), 0), stateId(program->getInitialState()),
+      stepCount(0), halted(false), accepted(false) {
+    const uint8_t blank = alphabet->encode(alphabet->getBlankSymbol());
+    tapes.reserve(tm.getNumberOfTapes());
+    for (int i = 0; i < tm.getNumberOfTapes(); i++) {
+        // La primera cinta contiene la entrada; las demás empiezan vacías
+        tapes.emplace_back(i == 0 ? input : std::string(), blank);
+    }
+}
+
+bool PersistentRun::step() {
+    if (halted) {
+        return false;
+    }
+    for (size_t i = 0; i < tapes.size(); i++) {
+        readBuffer[i] = tapes[i].read();
+    }
+    const TransitionTable::Entry* entry = program->find(stateId, readBuffer.data());
+    if (entry == nullptr) {
+        halted = true;
+        return false;
+    }
+
+    const uint8_t* writeCodes = program->getWriteCodes(*entry);
+    const int8_t* moves = program->getMoves(*entry);
+    for (size_t i = 0; i < tapes.size(); i++) {
+        if (!entry->encodable) {
+            // Símbolo sin código: encode() informa del error
+            alphabet->encode(entry->source->getWriteSymbols()[i]);
+        }
+        tapes[i].write(writeCodes[i]);
+        tapes[i].move(moves[i]);
+    }
+    stateId = entry->next;
+    stepCount++;
+
+    if (program->isAccepting(stateId)) {
+        accepted = true;
+        halted = true;
+    }
+    return true;
+}
+
+long long PersistentRun::run(long long maxSteps) {
+    long long taken = 0;
+    while (taken < maxSteps && step()) {
+        taken++;
+    }
+    return taken;
+}
+
+const std::string& PersistentRun::getStateName() const {
+    return program->getState(stateId).getName();
+}
+
+std::string PersistentRun::getTapeContent(int index) const {
+    return tapes[index].getVisibleContent(*alphabet);
+}
+
+std::string PersistentRun::getConfiguration() const {
+    std::string config = "Estado: " + getStateName();
+    if (tapes.size() > 1) {
+        for (size_t i = 0; i < tapes.size(); i++) {
+            config += "\nCinta " + std::to_string(i + 1) + ": [" + getTapeContent(static_cast<int>(i)) +
+                      "], Cabezal: " + std::to_string(tapes[i].getHeadPosition());
+        }
+    } else {
+        config += ", Cinta: [" + getTapeContent(0) + "], Cabezal: " +
+                  std::to_string(tapes[0].getHeadPosition());
+    }
+    return config;
+}
+
+size_t PersistentRun::countChunks(const std::vector<PersistentRun>& runs) {
+    std::unordered_set<const void*> seen;
+    size_t count = 0;
+    for (const PersistentRun& run : runs) {
+        for (const PersistentTape& tape : run.tapes) {
+            count += tape.collectChunks(seen);
+        }
+    }
+    return count;
+}
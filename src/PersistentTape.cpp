@@ -0,0 +1,192 @@
+#include "../include/PersistentTape.h"
+#include "../include/Alphabet.h"
+#include <algorithm>
+#include <climits>
+
+namespace {
+
+constexpr long long CHUNK = static_cast<long long>(PersistentTape::CHUNK_SIZE);
+constexpr uint64_t CHILD_MASK = PersistentTape::FANOUT - 1;
+
+// Índice no negativo de la posición dentro de su mitad de la cinta
+inline uint64_t sideIndex(long long position) {
+    return position >= 0 ? static_cast<uint64_t>(position) : static_cast<uint64_t>(-(position + 1));
+}
+
+inline size_t cellOffset(long long position) {
+    return static_cast<size_t>(sideIndex(position) % PersistentTape::CHUNK_SIZE);
+}
+
+}  // namespace
+
+PersistentTape::PersistentTape(const std::string& content, uint8_t blank)
+    : right{nullptr, 0}, left{nullptr, 0}, blankCode(blank), head(0), leftEdge(0),
+      rightEdge(std::max(static_cast<long long>(content.size()), 1LL)),
+      writable(nullptr), writableChunk(0) {
+    // Solo se crean los trozos con algún símbolo no blanco
+    const uint8_t* source = reinterpret_cast<const uint8_t*>(content.data());
+    const long long length = static_cast<long long>(content.size());
+    for (long long offset = 0; offset < length; offset += CHUNK) {
+        const long long count = std::min(CHUNK, length - offset);
+        if (std::all_of(source + offset, source + offset + count, [blank](uint8_t c) { return c == blank; })) {
+            continue;
+        }
+        std::copy(source + offset, source + offset + count, ownChunk(offset));
+    }
+}
+
+PersistentTape::PersistentTape(const PersistentTape& other)
+    : right(other.right), left(other.left), blankCode(other.blankCode), head(other.head),
+      leftEdge(other.leftEdge), rightEdge(other.rightEdge), writable(nullptr), writableChunk(0) {
+    // El trozo del cabezal pasa a estar compartido: la próxima escritura lo copia
+    other.writable = nullptr;
+}
+
+PersistentTape& PersistentTape::operator=(const PersistentTape& other) {
+    if (this != &other) {
+        right = other.right;
+        left = other.left;
+        blankCode = other.blankCode;
+        head = other.head;
+        leftEdge = other.leftEdge;
+        rightEdge = other.rightEdge;
+        writable = nullptr;
+        other.writable = nullptr;
+    }
+    return *this;
+}
+
+uint8_t PersistentTape::readAt(long long position) const {
+    if (writable != nullptr && chunkOf(position) == writableChunk) {
+        return writable[cellOffset(position)];
+    }
+    const uint8_t* chunk = findChunk(position);
+    return chunk == nullptr ? blankCode : chunk[cellOffset(position)];
+}
+
+void PersistentTape::write(uint8_t code) {
+    const long long chunk = chunkOf(head);
+    if (writable == nullptr || chunk != writableChunk) {
+        if (code == blankCode && findChunk(head) == nullptr) {
+            return;  // Un trozo inexistente ya es blanco
+        }
+        writable = ownChunk(head);
+        writableChunk = chunk;
+    }
+    writable[cellOffset(head)] = code;
+}
+
+void PersistentTape::move(int8_t delta) {
+    head += delta;
+    if (head < leftEdge) {
+        leftEdge = head;
+    } else if (head >= rightEdge) {
+        rightEdge = head + 1;
+    }
+}
+
+std::string PersistentTape::getVisibleContent(const Alphabet& alphabet) const {
+    // Un descenso por el árbol por trozo, no por celda
+    long long current = LLONG_MIN;
+    const uint8_t* chunk = nullptr;
+    auto cell = [&](long long position) {
+        const long long index = chunkOf(position);
+        if (index != current) {
+            current = index;
+            chunk = (writable != nullptr && index == writableChunk) ? writable : findChunk(position);
+        }
+        return chunk == nullptr ? blankCode : chunk[cellOffset(position)];
+    };
+
+    long long first = leftEdge;
+    while (first < rightEdge && cell(first) == blankCode) {
+        first++;
+    }
+    if (first == rightEdge) {
+        return "";
+    }
+    long long last = rightEdge - 1;
+    while (cell(last) == blankCode) {
+        last--;
+    }
+
+    std::string content;
+    content.reserve(static_cast<size_t>(last - first + 1));
+    for (long long position = first; position <= last; position++) {
+        content += alphabet.decode(cell(position));
+    }
+    return content;
+}
+
+size_t PersistentTape::collectChunks(std::unordered_set<const void*>& seen) const {
+    return collectNode(right.root.get(), seen) + collectNode(left.root.get(), seen);
+}
+
+size_t PersistentTape::collectNode(const Node* node, std::unordered_set<const void*>& seen) {
+    // Un nodo ya visto implica todo su subárbol
+    if (node == nullptr || !seen.insert(node).second) {
+        return 0;
+    }
+    if (node->children.empty()) {
+        return 1;
+    }
+    size_t count = 0;
+    for (const NodePtr& child : node->children) {
+        count += collectNode(child.get(), seen);
+    }
+    return count;
+}
+
+const uint8_t* PersistentTape::findChunk(long long position) const {
+    const Side& side = position >= 0 ? right : left;
+    const uint64_t chunk = sideIndex(position) / CHUNK_SIZE;
+    if (!side.root || (chunk >> (FANOUT_BITS * side.depth)) != 0) {
+        return nullptr;
+    }
+    const Node* node = side.root.get();
+    for (int level = side.depth; level > 0; level--) {
+        node = node->children[(chunk >> (FANOUT_BITS * (level - 1))) & CHILD_MASK].get();
+        if (node == nullptr) {
+            return nullptr;
+        }
+    }
+    return node->cells.data();
+}
+
+uint8_t* PersistentTape::ownChunk(long long position) {
+    Side& side = position >= 0 ? right : left;
+    const uint64_t chunk = sideIndex(position) / CHUNK_SIZE;
+
+    // Crecer por la raíz hasta cubrir el trozo
+    while (side.root && (chunk >> (FANOUT_BITS * side.depth)) != 0) {
+        NodePtr parent = std::make_shared<Node>();
+        parent->children.resize(FANOUT);
+        parent->children[0] = std::move(side.root);
+        side.root = std::move(parent);
+        side.depth++;
+    }
+    if (!side.root) {
+        while ((chunk >> (FANOUT_BITS * side.depth)) != 0) {
+            side.depth++;
+        }
+    }
+
+    // Copiar el camino: cada nodo compartido se sustituye por una copia propia
+    NodePtr* slot = &side.root;
+    for (int level = side.depth;; level--) {
+        if (!*slot) {
+            *slot = std::make_shared<Node>();
+            if (level == 0) {
+                (*slot)->cells.assign(CHUNK_SIZE, blankCode);
+            } else {
+                (*slot)->children.resize(FANOUT);
+            }
+        } else if (slot->use_count() > 1) {
+            *slot = std::make_shared<Node>(**slot);
+        }
+        if (level == 0) {
+            return (*slot)->cells.data();
+        }
+        slot = &(*slot)->children[(chunk >> (FANOUT_BITS * (level - 1))) & CHILD_MASK];
+    }
+}
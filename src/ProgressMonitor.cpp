@@ -0,0 +1,107 @@
+#include "../include/ProgressMonitor.h"
+#include "../include/TuringMachine.h"
+#include "../include/RunStats.h"
+#include "../include/MTException.h"
+#include <csignal>
+#include <iostream>
+#include <sstream>
+
+namespace {
+
+// Indicador activado por SIGUSR1 (solo se escribe desde el manejador)
+volatile std::sig_atomic_t signalRequested = 0;
+
+#ifdef SIGUSR1
+extern "C" void onProgressSignal(int) {
+    signalRequested = 1;
+}
+#endif
+
+double elapsedSeconds(std::chrono::steady_clock::time_point from,
+                      std::chrono::steady_clock::time_point to) {
+    return std::chrono::duration<double>(to - from).count();
+}
+
+}  // namespace
+
+ProgressMonitor::ProgressMonitor(const std::string& destination, double interval)
+    : requested(false), intervalSeconds(interval), out(&std::cerr), stopping(false), lastStep(0) {
+    if (destination != "-") {
+        file.open(destination, std::ios::out | std::ios::app);
+        if (!file.is_open()) {
+            throw MTException("No se pudo abrir el archivo de progreso: " + destination);
+        }
+        out = &file;
+    }
+#ifdef SIGUSR1
+    std::signal(SIGUSR1, onProgressSignal);
+#endif
+    if (intervalSeconds > 0.0) {
+        timer = std::thread(&ProgressMonitor::timerLoop, this);
+    }
+    beginRun();
+}
+
+ProgressMonitor::~ProgressMonitor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    if (timer.joinable()) {
+        timer.join();
+    }
+#ifdef SIGUSR1
+    std::signal(SIGUSR1, SIG_DFL);
+#endif
+}
+
+void ProgressMonitor::beginRun() {
+    runStart = std::chrono::steady_clock::now();
+    lastSnapshot = runStart;
+    lastStep = 0;
+}
+
+bool ProgressMonitor::pending() const {
+    return requested.load(std::memory_order_relaxed) || signalRequested != 0;
+}
+
+void ProgressMonitor::snapshot(const TuringMachine& tm) {
+    requested.store(false, std::memory_order_relaxed);
+    signalRequested = 0;
+
+    auto now = std::chrono::steady_clock::now();
+    long long step = tm.getStepCount();
+    double window = elapsedSeconds(lastSnapshot, now);
+    double rate = window > 0.0 ? static_cast<double>(step - lastStep) / window : 0.0;
+
+    std::ostringstream line;
+    line.precision(3);
+    line << std::fixed;
+    line << "{\"step\":" << step
+         << ",\"state\":" << RunStats::quote(tm.getCurrentState().getName())
+         << ",\"elapsed_s\":" << elapsedSeconds(runStart, now)
+         << ",\"steps_per_sec\":" << rate
+         << ",\"tapes\":[";
+    for (int i = 0; i < tm.getNumberOfTapes(); i++) {
+        const Tape* tape = tm.getTape(i);
+        if (i > 0) line << ",";
+        line << "{\"head\":" << (tape ? tape->getHeadPosition() : 0)
+             << ",\"cells_reached\":" << (tape ? tape->getCellsReached() : 0) << "}";
+    }
+    line << "]}\n";
+    *out << line.str() << std::flush;
+
+    lastSnapshot = now;
+    lastStep = step;
+}
+
+void ProgressMonitor::timerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto period = std::chrono::duration<double>(intervalSeconds);
+    while (!stopping) {
+        if (!wakeUp.wait_for(lock, period, [this] { return stopping; })) {
+            requested.store(true, std::memory_order_relaxed);
+        }
+    }
+}
@@ -0,0 +1,119 @@
+#include "../include/ResourceGovernor.h"
+#include "../include/MTException.h"
+#include <string>
+
+// ResourceGovernor
+
+ResourceGovernor::ResourceGovernor() : maxBytes(0), bytesInUse(0) {
+}
+
+ResourceGovernor& ResourceGovernor::process() {
+    static ResourceGovernor instance;
+    return instance;
+}
+
+void ResourceGovernor::setMaxBytes(long long bytes) {
+    maxBytes.store(bytes < 0 ? 0 : bytes);
+}
+
+long long ResourceGovernor::getMaxBytes() const {
+    return maxBytes.load();
+}
+
+long long ResourceGovernor::getBytesInUse() const {
+    return bytesInUse.load();
+}
+
+bool ResourceGovernor::tryReserve(long long bytes) {
+    const long long limit = maxBytes.load(std::memory_order_relaxed);
+    if (limit == 0) {
+        bytesInUse.fetch_add(bytes, std::memory_order_relaxed);
+        return true;
+    }
+    long long current = bytesInUse.load(std::memory_order_relaxed);
+    do {
+        if (current + bytes > limit) {
+            return false;
+        }
+    } while (!bytesInUse.compare_exchange_weak(current, current + bytes, std::memory_order_relaxed));
+    return true;
+}
+
+void ResourceGovernor::release(long long bytes) {
+    bytesInUse.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+ResourceLimits ResourceGovernor::share(const ResourceLimits& perRun, int concurrentRuns) const {
+    ResourceLimits result = perRun;
+    const long long limit = maxBytes.load();
+    if (limit > 0) {
+        long long part = limit / (concurrentRuns < 1 ? 1 : concurrentRuns);
+        if (result.maxBytes == 0 || result.maxBytes > part) {
+            result.maxBytes = part;
+        }
+    }
+    return result;
+}
+
+// ResourceBudget
+
+ResourceBudget::ResourceBudget(const ResourceLimits& runLimits, ResourceGovernor* processGovernor)
+    : limits(runLimits), bytesInUse(0), peakBytes(0), governor(processGovernor) {
+}
+
+ResourceBudget::~ResourceBudget() {
+    if (governor != nullptr && bytesInUse > 0) {
+        governor->release(bytesInUse);
+    }
+}
+
+void ResourceBudget::setLimits(const ResourceLimits& runLimits) {
+    limits = runLimits;
+}
+
+const ResourceLimits& ResourceBudget::getLimits() const {
+    return limits;
+}
+
+void ResourceBudget::chargeBytes(long long bytes) {
+    if (limits.maxBytes > 0 && bytesInUse + bytes > limits.maxBytes) {
+        throw ResourceLimitException("memoria de la ejecución (" + std::to_string(limits.maxBytes) +
+                                     " bytes)");
+    }
+    if (governor != nullptr && !governor->tryReserve(bytes)) {
+        throw ResourceLimitException("memoria global del proceso (" +
+                                     std::to_string(governor->getMaxBytes()) + " bytes)");
+    }
+    bytesInUse += bytes;
+    if (bytesInUse > peakBytes) {
+        peakBytes = bytesInUse;
+    }
+}
+
+void ResourceBudget::releaseBytes(long long bytes) {
+    bytesInUse -= bytes;
+    if (governor != nullptr) {
+        governor->release(bytes);
+    }
+}
+
+long long ResourceBudget::getBytesInUse() const {
+    return bytesInUse;
+}
+
+long long ResourceBudget::getPeakBytes() const {
+    return peakBytes;
+}
+
+bool ResourceBudget::isUnlimited() const {
+    return limits.maxTapeCells == 0 && limits.maxBytes == 0 && (governor == nullptr || governor->getMaxBytes() == 0);
+}
+
+void ResourceBudget::resetPeak() {
+    peakBytes = bytesInUse;
+}
+
+void ResourceBudget::throwTapeCells(long long cells) const {
+    throw ResourceLimitException("celdas de cinta (" + std::to_string(cells) + " > " +
+                                 std::to_string(limits.maxTapeCells) + ")");
+}
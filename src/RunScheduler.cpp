@@ -0,0 +1,162 @@
+#include "../include/RunScheduler.h"
+#include "../include/ExecutionContext.h"
+#include <algorithm>
+
+RunScheduler::Job::~Job() {
+    delete context;
+}
+
+void RunScheduler::Handle::cancel() const {
+    if (job != nullptr) {
+        job->cancelRequested = true;
+    }
+}
+
+RunScheduler::RunScheduler(int workerCount, long long sliceSteps, SchedulingPolicy policy)
+    : sliceSteps(sliceSteps > 0 ? sliceSteps : 1), policy(policy), submitted(0), stopping(false) {
+    if (workerCount <= 0) {
+        workerCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+    for (int i = 0; i < workerCount; i++) {
+        workers.emplace_back(&RunScheduler::workerLoop, this);
+    }
+}
+
+RunScheduler::~RunScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    // Lo que no llegó a terminar se entrega como cancelado
+    for (const std::shared_ptr<Job>& job : ready) {
+        job->cancelRequested = true;
+        complete(*job);
+    }
+}
+
+RunScheduler::Handle RunScheduler::submit(ExecutionContext* context, const std::string& input, long long maxSteps,
+                                          int priority) {
+    auto job = std::make_shared<Job>();
+    job->context = context;
+    job->input = input;
+    job->maxSteps = maxSteps;
+    job->priority = priority;
+    Handle handle(job, job->promise.get_future().share());
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job->sequence = submitted++;
+        ready.push_back(std::move(job));
+    }
+    wakeUp.notify_one();
+    return handle;
+}
+
+void RunScheduler::workerLoop() {
+    for (;;) {
+        std::shared_ptr<Job> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeUp.wait(lock, [this] { return stopping || !ready.empty(); });
+            if (stopping) {
+                return;
+            }
+            job = takeNext();
+        }
+
+        bool finished;
+        try {
+            finished = runSlice(*job);
+        } catch (...) {
+            job->promise.set_exception(std::current_exception());
+            continue;
+        }
+        if (finished) {
+            complete(*job);
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ready.push_back(std::move(job));
+        }
+        wakeUp.notify_one();
+    }
+}
+
+std::shared_ptr<RunScheduler::Job> RunScheduler::takeNext() {
+    // La cola es corta comparada con una porción: basta una búsqueda lineal
+    auto better = [this](const std::shared_ptr<Job>& a, const std::shared_ptr<Job>& b) {
+        // Las canceladas salen enseguida, sin esperar a su turno
+        if (a->cancelRequested != b->cancelRequested) {
+            return a->cancelRequested.load();
+        }
+        if (a->priority != b->priority) {
+            return a->priority > b->priority;
+        }
+        if (policy == SchedulingPolicy::ShortestRemaining) {
+            // Lo que queda de presupuesto premiaría a la que más lleva ejecutado y, con el mismo
+            // presupuesto para todas, la primera no soltaría el hilo hasta terminar: se estima
+            // por el presupuesto completo y se desempata por el servicio recibido
+            if (a->maxSteps != b->maxSteps) {
+                return a->maxSteps < b->maxSteps;
+            }
+            if (a->slices != b->slices) {
+                return a->slices < b->slices;
+            }
+        } else {
+            const long long doneA = a->started ? a->context->getStepCount() : 0;
+            const long long doneB = b->started ? b->context->getStepCount() : 0;
+            if (doneA != doneB) {
+                return doneA < doneB;
+            }
+        }
+        return a->sequence < b->sequence;
+    };
+    auto best = std::min_element(ready.begin(), ready.end(), better);
+    std::shared_ptr<Job> job = std::move(*best);
+    *best = std::move(ready.back());
+    ready.pop_back();
+    return job;
+}
+
+bool RunScheduler::runSlice(Job& job) {
+    if (job.cancelRequested) {
+        return true;
+    }
+    ExecutionContext& context = *job.context;
+    if (!job.started) {
+        context.reset(job.input);
+        job.started = true;
+    }
+    job.slices++;
+
+    const long long sliceEnd = std::min(job.maxSteps, context.getStepCount() + sliceSteps);
+    context.run(sliceEnd - context.getStepCount());
+    return context.isHalted() || context.getStepCount() >= job.maxSteps;
+}
+
+void RunScheduler::complete(Job& job) {
+    ScheduledResult result;
+    result.cancelled = job.cancelRequested;
+    result.slices = job.slices;
+    if (job.started) {
+        const ExecutionContext& context = *job.context;
+        result.accepted = context.wasAccepted();
+        result.halted = context.isHalted();
+        result.limitExceeded = context.exceededLimits();
+        result.limitReason = context.getLimitReason();
+        result.divergence = context.getDivergenceReason();
+        result.steps = context.getStepCount();
+        result.finalState = context.getStateName();
+        for (int i = 0; i < context.getTapeCount(); i++) {
+            result.tapes.push_back(context.getTapeContent(i));
+        }
+        result.headPosition = context.getHeadPosition();
+    }
+    job.promise.set_value(result);
+}
@@ -0,0 +1,107 @@
+#include "../include/RunStats.h"
+#include "../include/TuringMachine.h"
+#include <cstdio>
+#include <sstream>
+
+RunStats::RunStats()
+    : inputLength(0), steps(0), loadTimeMs(0.0), wallTimeMs(0.0), stepsPerSecond(0.0),
+      transitionLookups(0), peakMemoryBytes(0) {
+}
+
+void RunStats::collect(const TuringMachine& tm) {
+    if (tm.exceededLimits()) {
+        result = "limit";
+        limitReason = tm.getLimitReason();
+        divergence.clear();
+    } else if (tm.hasDiverged()) {
+        result = "diverge";
+        limitReason.clear();
+        divergence = tm.getDivergenceReason();
+    } else {
+        result = tm.wasAccepted() ? "accept" : "reject";
+        limitReason.clear();
+        divergence.clear();
+    }
+    steps = tm.getStepCount();
+    finalState = tm.getCurrentState().getName();
+    transitionLookups = tm.getTransitionLookups();
+    peakMemoryBytes = tm.getResourceBudget().getPeakBytes();
+    stepsPerSecond = wallTimeMs > 0.0 ? static_cast<double>(steps) / (wallTimeMs / 1000.0) : 0.0;
+
+    tapes.clear();
+    for (int i = 0; i < tm.getNumberOfTapes(); i++) {
+        TapeStats stats = {0, 0, -1, -1, 0, 0};
+        const Tape* tape = tm.getTape(i);
+        if (tape != nullptr) {
+            stats.cellsReached = tape->getCellsReached();
+            stats.headPosition = tape->getHeadPosition();
+            if (!tape->getNonBlankBounds(stats.nonBlankFirst, stats.nonBlankLast)) {
+                stats.nonBlankFirst = -1;
+                stats.nonBlankLast = -1;
+            }
+            stats.pagesAllocated = static_cast<long long>(tape->getAllocatedPages());
+            stats.cellsAllocated = stats.pagesAllocated * static_cast<long long>(Tape::PAGE_SIZE);
+        }
+        tapes.push_back(stats);
+    }
+}
+
+std::string RunStats::toJson() const {
+    std::ostringstream out;
+    out.precision(3);
+    out << std::fixed;
+    out << "{\"machine\":" << quote(machineFile)
+        << ",\"input_length\":" << inputLength
+        << ",\"result\":" << quote(result);
+    if (!limitReason.empty()) {
+        out << ",\"limit_reason\":" << quote(limitReason);
+    }
+    if (!divergence.empty()) {
+        out << ",\"divergence\":" << quote(divergence);
+    }
+    out << ",\"steps\":" << steps
+        << ",\"final_state\":" << quote(finalState)
+        << ",\"load_time_ms\":" << loadTimeMs
+        << ",\"wall_time_ms\":" << wallTimeMs
+        << ",\"steps_per_sec\":" << stepsPerSecond
+        << ",\"transition_lookups\":" << transitionLookups
+        << ",\"peak_memory_bytes\":" << peakMemoryBytes
+        << ",\"tapes\":[";
+    for (size_t i = 0; i < tapes.size(); i++) {
+        const TapeStats& tape = tapes[i];
+        if (i > 0) out << ",";
+        out << "{\"cells_reached\":" << tape.cellsReached
+            << ",\"head\":" << tape.headPosition
+            << ",\"nonblank_first\":" << tape.nonBlankFirst
+            << ",\"nonblank_last\":" << tape.nonBlankLast
+            << ",\"final_extent\":"
+            << (tape.nonBlankFirst < 0 ? 0 : tape.nonBlankLast - tape.nonBlankFirst + 1)
+            << ",\"pages_allocated\":" << tape.pagesAllocated
+            << ",\"cells_allocated\":" << tape.cellsAllocated << "}";
+    }
+    out << "]}";
+    return out.str();
+}
+
+std::string RunStats::quote(const std::string& text) {
+    std::string result = "\"";
+    for (char c : text) {
+        switch (c) {
+            case '"': result += "\\\""; break;
+            case '\\': result += "\\\\"; break;
+            case '\n': result += "\\n"; break;
+            case '\r': result += "\\r"; break;
+            case '\t': result += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buffer[8];
+                    std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned char>(c));
+                    result += buffer;
+                } else {
+                    result += c;
+                }
+        }
+    }
+    result += "\"";
+    return result;
+}
@@ -0,0 +1,401 @@
+#include "../include/SimdKernels.h"
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMD_KERNELS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// Variantes SSSE3/AVX2: con GCC/Clang se compilan siempre y se eligen en
+// tiempo de ejecución; con otros compiladores solo si el objetivo ya es AVX2
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_KERNELS_WIDE 1
+#define SIMD_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#elif defined(__AVX2__)
+#define SIMD_KERNELS_WIDE 1
+#define SIMD_TARGET_SSSE3
+#define SIMD_TARGET_AVX2
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// ByteSet
+
+ByteSet::ByteSet() {
+    clear();
+}
+
+void ByteSet::insert(uint8_t value) {
+    member[value] = 1;
+    unsigned high = value >> 4;
+    unsigned low = value & 0x0F;
+    if (high < 8) {
+        lowNibble0[low] |= static_cast<uint8_t>(1u << high);
+    } else {
+        lowNibble1[low] |= static_cast<uint8_t>(1u << (high - 8));
+    }
+}
+
+void ByteSet::clear() {
+    std::memset(member, 0, sizeof(member));
+    std::memset(lowNibble0, 0, sizeof(lowNibble0));
+    std::memset(lowNibble1, 0, sizeof(lowNibble1));
+}
+
+namespace {
+
+/**
+ * Índice del bit menos significativo a 1 (mask != 0)
+ */
+inline unsigned lowestSetBit(uint32_t mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+/**
+ * Índice del bit más significativo a 1 (mask != 0)
+ */
+inline unsigned highestSetBit(uint32_t mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return 31u - static_cast<unsigned>(__builtin_clz(mask));
+#endif
+}
+
+// Versiones escalares
+
+size_t firstNotEqualScalar(const uint8_t* data, size_t length, uint8_t value) {
+    for (size_t i = 0; i < length; i++) {
+        if (data[i] != value) {
+            return i;
+        }
+    }
+    return length;
+}
+
+size_t lastNotEqualScalar(const uint8_t* data, size_t length, uint8_t value) {
+    for (size_t i = length; i > 0; i--) {
+        if (data[i - 1] != value) {
+            return i - 1;
+        }
+    }
+    return length;
+}
+
+size_t firstNotInSetScalar(const uint8_t* data, size_t length, const ByteSet& set) {
+    // Bloques de 64 bytes sin saltos; solo se comprueba al final de cada bloque
+    size_t i = 0;
+    for (; i + 64 <= length; i += 64) {
+        unsigned ok = 1;
+        for (size_t j = 0; j < 64; j++) {
+            ok &= set.member[data[i + j]];
+        }
+        if (!ok) {
+            break;
+        }
+    }
+    for (; i < length; i++) {
+        if (!set.member[data[i]]) {
+            return i;
+        }
+    }
+    return length;
+}
+
+size_t lastNotInSetScalar(const uint8_t* data, size_t length, const ByteSet& set) {
+    for (size_t i = length; i-- > 0;) {
+        if (!set.member[data[i]]) {
+            return i;
+        }
+    }
+    return length;
+}
+
+bool allInSetScalar(const uint8_t* data, size_t length, const ByteSet& set) {
+    return firstNotInSetScalar(data, length, set) == length;
+}
+
+void gather32Scalar(const int32_t* table, const int32_t* indices, int32_t* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        out[i] = table[indices[i]];
+    }
+}
+
+#ifdef SIMD_KERNELS_SSE2
+
+size_t firstNotEqualSSE2(const uint8_t* data, size_t length, uint8_t value) {
+    const __m128i needle = _mm_set1_epi8(static_cast<char>(value));
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+        if (mask != 0xFFFFu) {
+            return i + lowestSetBit(~mask & 0xFFFFu);
+        }
+    }
+    size_t tail = firstNotEqualScalar(data + i, length - i, value);
+    return i + tail;
+}
+
+size_t lastNotEqualSSE2(const uint8_t* data, size_t length, uint8_t value) {
+    const __m128i needle = _mm_set1_epi8(static_cast<char>(value));
+    size_t i = length;
+    while (i >= 16) {
+        i -= 16;
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+        if (mask != 0xFFFFu) {
+            return i + highestSetBit(~mask & 0xFFFFu);
+        }
+    }
+    size_t head = lastNotEqualScalar(data, i, value);
+    return head == i ? length : head;
+}
+
+#endif // SIMD_KERNELS_SSE2
+
+#ifdef SIMD_KERNELS_WIDE
+
+/**
+ * Pertenencia a un conjunto arbitrario de 256 bytes con pshufb:
+ * el nibble bajo selecciona la fila del mapa de bits y el alto el bit
+ * @return Máscara con el bit i activo si el byte i pertenece al conjunto
+ */
+SIMD_TARGET_SSSE3
+inline uint32_t memberMaskSSSE3(const uint8_t* data, const ByteSet& set) {
+    const __m128i table0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.lowNibble0));
+    const __m128i table1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.lowNibble1));
+    const __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    __m128i low = _mm_and_si128(chunk, nibble);
+    __m128i high = _mm_and_si128(_mm_srli_epi16(chunk, 4), nibble);
+    __m128i row0 = _mm_shuffle_epi8(table0, low);
+    __m128i row1 = _mm_shuffle_epi8(table1, low);
+    __m128i upper = _mm_cmpgt_epi8(high, _mm_set1_epi8(7));
+    __m128i row = _mm_or_si128(_mm_and_si128(upper, row1), _mm_andnot_si128(upper, row0));
+    __m128i bit = _mm_shuffle_epi8(bits, high);
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(row, bit), bit)));
+}
+
+SIMD_TARGET_SSSE3
+size_t firstNotInSetSSSE3(const uint8_t* data, size_t length, const ByteSet& set) {
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        uint32_t mask = memberMaskSSSE3(data + i, set);
+        if (mask != 0xFFFF) {
+            return i + lowestSetBit(~mask);
+        }
+    }
+    return i + firstNotInSetScalar(data + i, length - i, set);
+}
+
+SIMD_TARGET_SSSE3
+size_t lastNotInSetSSSE3(const uint8_t* data, size_t length, const ByteSet& set) {
+    size_t i = length;
+    while (i >= 16) {
+        i -= 16;
+        uint32_t mask = memberMaskSSSE3(data + i, set);
+        if (mask != 0xFFFF) {
+            return i + highestSetBit(~mask & 0xFFFF);
+        }
+    }
+    size_t head = lastNotInSetScalar(data, i, set);
+    return head == i ? length : head;
+}
+
+SIMD_TARGET_SSSE3
+bool allInSetSSSE3(const uint8_t* data, size_t length, const ByteSet& set) {
+    return firstNotInSetSSSE3(data, length, set) == length;
+}
+
+SIMD_TARGET_AVX2
+inline uint32_t memberMaskAVX2(const uint8_t* data, const ByteSet& set) {
+    const __m256i table0 = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.lowNibble0)));
+    const __m256i table1 = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.lowNibble1)));
+    const __m256i bits = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+                                          1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    __m256i low = _mm256_and_si256(chunk, nibble);
+    __m256i high = _mm256_and_si256(_mm256_srli_epi16(chunk, 4), nibble);
+    __m256i row0 = _mm256_shuffle_epi8(table0, low);
+    __m256i row1 = _mm256_shuffle_epi8(table1, low);
+    __m256i upper = _mm256_cmpgt_epi8(high, _mm256_set1_epi8(7));
+    __m256i row = _mm256_blendv_epi8(row0, row1, upper);
+    __m256i bit = _mm256_shuffle_epi8(bits, high);
+    return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit)));
+}
+
+SIMD_TARGET_AVX2
+size_t firstNotInSetAVX2(const uint8_t* data, size_t length, const ByteSet& set) {
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        uint32_t mask = memberMaskAVX2(data + i, set);
+        if (mask != 0xFFFFFFFFu) {
+            return i + lowestSetBit(~mask);
+        }
+    }
+    return i + firstNotInSetScalar(data + i, length - i, set);
+}
+
+SIMD_TARGET_AVX2
+size_t lastNotInSetAVX2(const uint8_t* data, size_t length, const ByteSet& set) {
+    size_t i = length;
+    while (i >= 32) {
+        i -= 32;
+        uint32_t mask = memberMaskAVX2(data + i, set);
+        if (mask != 0xFFFFFFFFu) {
+            return i + highestSetBit(~mask);
+        }
+    }
+    size_t head = lastNotInSetScalar(data, i, set);
+    return head == i ? length : head;
+}
+
+SIMD_TARGET_AVX2
+bool allInSetAVX2(const uint8_t* data, size_t length, const ByteSet& set) {
+    return firstNotInSetAVX2(data, length, set) == length;
+}
+
+SIMD_TARGET_AVX2
+size_t firstNotEqualAVX2(const uint8_t* data, size_t length, uint8_t value) {
+    const __m256i needle = _mm256_set1_epi8(static_cast<char>(value));
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle)));
+        if (mask != 0xFFFFFFFFu) {
+            return i + lowestSetBit(~mask);
+        }
+    }
+    size_t tail = firstNotEqualScalar(data + i, length - i, value);
+    return i + tail;
+}
+
+SIMD_TARGET_AVX2
+size_t lastNotEqualAVX2(const uint8_t* data, size_t length, uint8_t value) {
+    const __m256i needle = _mm256_set1_epi8(static_cast<char>(value));
+    size_t i = length;
+    while (i >= 32) {
+        i -= 32;
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle)));
+        if (mask != 0xFFFFFFFFu) {
+            return i + highestSetBit(~mask);
+        }
+    }
+    size_t head = lastNotEqualScalar(data, i, value);
+    return head == i ? length : head;
+}
+
+SIMD_TARGET_AVX2
+void gather32AVX2(const int32_t* table, const int32_t* indices, int32_t* out, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+        __m256i value = _mm256_i32gather_epi32(reinterpret_cast<const int*>(table), index, 4);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), value);
+    }
+    gather32Scalar(table, indices + i, out + i, count - i);
+}
+
+#endif // SIMD_KERNELS_WIDE
+
+/**
+ * Tabla de variantes elegida al primer uso
+ */
+struct KernelTable {
+    size_t (*firstNotEqual)(const uint8_t*, size_t, uint8_t);
+    size_t (*lastNotEqual)(const uint8_t*, size_t, uint8_t);
+    bool (*allInSet)(const uint8_t*, size_t, const ByteSet&);
+    size_t (*firstNotInSet)(const uint8_t*, size_t, const ByteSet&);
+    size_t (*lastNotInSet)(const uint8_t*, size_t, const ByteSet&);
+    void (*gather32)(const int32_t*, const int32_t*, int32_t*, size_t);
+    const char* name;
+};
+
+KernelTable selectKernels() {
+    KernelTable table = {firstNotEqualScalar, lastNotEqualScalar, allInSetScalar, firstNotInSetScalar,
+                         lastNotInSetScalar, gather32Scalar, "scalar"};
+#ifdef SIMD_KERNELS_SSE2
+    table.firstNotEqual = firstNotEqualSSE2;
+    table.lastNotEqual = lastNotEqualSSE2;
+    table.name = "sse2";
+#endif
+#ifdef SIMD_KERNELS_WIDE
+#if defined(__GNUC__)
+    __builtin_cpu_init();
+    const bool hasSSSE3 = __builtin_cpu_supports("ssse3");
+    const bool hasAVX2 = __builtin_cpu_supports("avx2");
+#else
+    const bool hasSSSE3 = true;
+    const bool hasAVX2 = true;
+#endif
+    if (hasSSSE3) {
+        table.allInSet = allInSetSSSE3;
+        table.firstNotInSet = firstNotInSetSSSE3;
+        table.lastNotInSet = lastNotInSetSSSE3;
+    }
+    if (hasAVX2) {
+        table.firstNotEqual = firstNotEqualAVX2;
+        table.lastNotEqual = lastNotEqualAVX2;
+        table.allInSet = allInSetAVX2;
+        table.firstNotInSet = firstNotInSetAVX2;
+        table.lastNotInSet = lastNotInSetAVX2;
+        table.gather32 = gather32AVX2;
+        table.name = "avx2";
+    }
+#endif
+    return table;
+}
+
+const KernelTable& kernels() {
+    static const KernelTable table = selectKernels();
+    return table;
+}
+
+}  // namespace
+
+size_t SimdKernels::findFirstNotEqual(const uint8_t* data, size_t length, uint8_t value) {
+    return kernels().firstNotEqual(data, length, value);
+}
+
+size_t SimdKernels::findLastNotEqual(const uint8_t* data, size_t length, uint8_t value) {
+    return kernels().lastNotEqual(data, length, value);
+}
+
+bool SimdKernels::allInSet(const uint8_t* data, size_t length, const ByteSet& set) {
+    return kernels().allInSet(data, length, set);
+}
+
+size_t SimdKernels::findFirstNotInSet(const uint8_t* data, size_t length, const ByteSet& set) {
+    return kernels().firstNotInSet(data, length, set);
+}
+
+size_t SimdKernels::findLastNotInSet(const uint8_t* data, size_t length, const ByteSet& set) {
+    return kernels().lastNotInSet(data, length, set);
+}
+
+void SimdKernels::gather32(const int32_t* table, const int32_t* indices, int32_t* out, size_t count) {
+    kernels().gather32(table, indices, out, count);
+}
+
+const char* SimdKernels::activeVariant() {
+    return kernels().name;
+}
@@ -21,7 +21,7 @@ State::State(const std::string& stateName, bool initial, bool acceptance)
 }
 
 // Getters
-std::string State::getName() const {
+const std::string& State::getName() const {
     return name;
 }
 
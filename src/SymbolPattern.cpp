@@ -0,0 +1,79 @@
+#include "../include/SymbolPattern.h"
+#include "../include/Transition.h"
+#include <tuple>
+
+namespace {
+
+bool isTapeReference(const std::string& field) {
+    if (field.size() < 2 || field[0] != '$') {
+        return false;
+    }
+    for (size_t i = 1; i < field.size(); i++) {
+        if (field[i] < '0' || field[i] > '9') {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Clave de precedencia: (-campos exactos, comodines '*', identificador)
+ */
+std::tuple<int, int, int> precedenceKey(const Transition& transition, const Alphabet& gamma) {
+    int exact = 0;
+    int any = 0;
+    for (const std::string& field : transition.getReadSymbols()) {
+        if (!SymbolPattern::isPattern(field, gamma)) {
+            exact++;
+        } else if (field == "*") {
+            any++;
+        }
+    }
+    return std::make_tuple(-exact, any, transition.getId());
+}
+
+}  // namespace
+
+bool SymbolPattern::isPattern(const std::string& field, const Alphabet& gamma) {
+    const bool syntax = field == "*" || (field.size() > 1 && field[0] == '@') || isTapeReference(field);
+    return syntax && !gamma.contains(field);
+}
+
+SymbolPattern SymbolPattern::parse(const std::string& field, bool write, int tapeIndex, const Alphabet& gamma,
+                                   const ClassMap& classes) {
+    SymbolPattern pattern = {Kind::Exact, field, nullptr, -1};
+    if (!isPattern(field, gamma)) {
+        return pattern;
+    }
+    if (field == "*") {
+        pattern.kind = write ? Kind::Tape : Kind::Any;
+        pattern.tape = tapeIndex;
+    } else if (field[0] == '@') {
+        pattern.kind = Kind::Class;
+        auto it = classes.find(field.substr(1));
+        pattern.members = it != classes.end() ? &it->second : nullptr;
+    } else {
+        pattern.kind = Kind::Tape;
+        // Fuera de rango: la validación informa del error
+        pattern.tape = field.size() > 6 ? -1 : std::stoi(field.substr(1)) - 1;
+    }
+    return pattern;
+}
+
+bool SymbolPattern::isPattern(const Transition& transition, const Alphabet& gamma) {
+    for (const std::string& field : transition.getReadSymbols()) {
+        if (isPattern(field, gamma)) {
+            return true;
+        }
+    }
+    for (const std::string& field : transition.getWriteSymbols()) {
+        if (isPattern(field, gamma)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SymbolPattern::precedes(const Transition& a, const Transition& b, const Alphabet& gamma) {
+    return precedenceKey(a, gamma) < precedenceKey(b, gamma);
+}
@@ -1,116 +1,798 @@
 #include "../include/Tape.h"
+#include "../include/TapeSpill.h"
+#include "../include/ResourceGovernor.h"
+#include "../include/SimdKernels.h"
+#include "../include/PageArena.h"
+#include "../include/MTException.h"
+#include "../include/InputSource.h"
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+#include <limits>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Blancos que se añaden tras la entrada para el movimiento inicial
+const long long INITIAL_PADDING = 10;
+
+// streamEnd de una cinta sin entrada pendiente
+const long long NOT_STREAMING = std::numeric_limits<long long>::max();
+
+// Tramos por llamada a writev y tamaño del bloque de decodificación
+const int OUTPUT_SEGMENTS = 64;
+const size_t OUTPUT_BUFFER = 64 * 1024;
+
+/**
+ * Tramo de memoria pendiente de escribir
+ */
+struct OutputSegment {
+    const char* data;
+    size_t length;
+};
+
+/**
+ * Escribe todos los tramos en el descriptor, reintentando las escrituras parciales
+ */
+void writeSegments(int fd, OutputSegment* segments, int count) {
+    int first = 0;
+    while (first < count) {
+#ifdef _WIN32
+        int written = _write(fd, segments[first].data, static_cast<unsigned>(segments[first].length));
+#else
+        struct iovec vector[OUTPUT_SEGMENTS];
+        for (int i = first; i < count; i++) {
+            vector[i - first].iov_base = const_cast<char*>(segments[i].data);
+            vector[i - first].iov_len = segments[i].length;
+        }
+        ssize_t written = writev(fd, vector, count - first);
+#endif
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw MTException("No se pudo escribir el contenido de la cinta: " + std::string(std::strerror(errno)));
+        }
+        // Descartar los tramos completos y recortar el primero parcial
+        size_t remaining = static_cast<size_t>(written);
+        while (first < count && remaining >= segments[first].length) {
+            remaining -= segments[first].length;
+            first++;
+        }
+        if (first < count) {
+            segments[first].data += remaining;
+            segments[first].length -= remaining;
+        }
+    }
+}
+
+}  // namespace
 
 /**
  * Constructor de Tape
  */
 Tape::Tape(const std::string& initialContent, const std::string& blank,
-           const Alphabet* alphabet)
-    : headPosition(0), blankSymbol(blank), tapeAlphabet(alphabet) {
-    // Inicializar la cinta con el contenido
-    for (char c : initialContent) {
-        cells.push_back(std::string(1, c));
-    }
-    // Agregar algunos blancos al final para movimiento
-    for (int i = 0; i < 10; i++) {
-        cells.push_back(blankSymbol);
+           const Alphabet* alphabet, ResourceBudget* runBudget,
+           TapeCursor* sharedCursor, PageArena* sharedArena)
+    : firstPage(0), blankSymbol(blank), blankCode(0), tapeAlphabet(alphabet), boundsStale(false),
+      cursor(sharedCursor != nullptr ? sharedCursor : &ownCursor),
+      arena(sharedArena != nullptr ? sharedArena : new PageArena(PAGE_SIZE)),
+      ownsArena(sharedArena == nullptr), blankView(nullptr),
+      spill(nullptr), maxResidentPages(0), residentPages(0), budget(runBudget),
+      input(nullptr), streamEnd(NOT_STREAMING), releaseConsumed(false), releasedEnd(0) {
+    *cursor = TapeCursor{0, 0, nullptr, nullptr, 0, 0, 0, -1};
+    try {
+        blankCode = codec().encode(blankSymbol);
+        blankView = arena->blankPage(blankCode);
+        reset(initialContent);
+    } catch (...) {
+        // Entrada fuera de presupuesto: devolver lo reservado antes de propagar
+        releasePages();
+        if (ownsArena) {
+            delete arena;
+        }
+        throw;
     }
 }
 
-std::string Tape::read() const {
-    if (headPosition >= 0 && headPosition < (int)cells.size()) {
-        return cells[headPosition];
+/**
+ * Destructor: libera las páginas (vuelven a la reserva)
+ */
+Tape::~Tape() {
+    releasePages();
+    if (ownsArena) {
+        delete arena;
     }
-    return blankSymbol;
+    delete spill;
+}
+
+const std::string& Tape::read() const {
+    return codec().decode(readCode());
 }
 
 void Tape::write(const std::string& symbol) {
-    expandIfNeeded();
-    if (headPosition >= 0 && headPosition < (int)cells.size()) {
-        cells[headPosition] = symbol;
-    }
+    writeCode(codec().encode(symbol));
 }
 
 void Tape::moveRight() {
-    headPosition++;
-    expandIfNeeded();
+    cursor->head++;
+    if (cursor->head >= cursor->rightEdge) {
+        if (cursor->head >= streamEnd) {
+            fillInput();
+        }
+        cursor->rightEdge = std::max(cursor->rightEdge, cursor->head + 1);
+        if (budget != nullptr) {
+            budget->checkTapeCells(cursor->rightEdge - cursor->leftEdge);
+        }
+    }
 }
 
 void Tape::moveLeft() {
-    headPosition--;
-    expandIfNeeded();
+    cursor->head--;
+    if (cursor->head < cursor->leftEdge) {
+        cursor->leftEdge = cursor->head;
+        if (budget != nullptr) {
+            budget->checkTapeCells(cursor->rightEdge - cursor->leftEdge);
+        }
+    }
 }
 
-int Tape::getHeadPosition() const {
-    return headPosition;
+const std::string& Tape::getBlankSymbol() const {
+    return blankSymbol;
+}
+
+long long Tape::getHeadPosition() const {
+    // Índice respecto a la celda más a la izquierda alcanzada
+    return cursor->head - cursor->leftEdge;
 }
 
 std::string Tape::getContent() const {
-    std::string result;
-    for (const auto& cell : cells) {
-        result += cell;
-    }
-    return result;
+    return decodeRange(cursor->leftEdge, cursor->rightEdge);
 }
 
 std::string Tape::getVisibleContent() const {
-    // Encontrar el primer y último símbolo no-blanco
-    int firstNonBlank = -1;
-    int lastNonBlank = -1;
-    
-    for (size_t i = 0; i < cells.size(); i++) {
-        if (cells[i] != blankSymbol) {
-            if (firstNonBlank == -1) {
-                firstNonBlank = i;
-            }
-            lastNonBlank = i;
-        }
-    }
-    
+    long long firstNonBlank;
+    long long lastNonBlank;
+
     // Si no hay símbolos no-blancos, devolver vacío
-    if (firstNonBlank == -1) {
+    if (!nonBlankExtent(firstNonBlank, lastNonBlank)) {
         return "";
     }
-    
+
     // Construir el contenido visible desde el primer hasta el último símbolo no-blanco
-    std::string result;
-    for (int i = firstNonBlank; i <= lastNonBlank; i++) {
-        result += cells[i];
+    return decodeRange(firstNonBlank, lastNonBlank + 1);
+}
+
+long long Tape::writeVisibleContent(int fd, const std::string& terminator) const {
+    OutputSegment segments[OUTPUT_SEGMENTS];
+    int count = 0;
+    long long total = 0;
+    const bool identity = !codec().hasMultiCharSymbols();
+    std::string buffer;
+
+    long long position = 0;
+    long long last = 0;
+    if (nonBlankExtent(position, last)) {
+        last++;
+    } else {
+        position = last = 0;
+    }
+    while (position < last) {
+        long long page = pageOf(position);
+        long long base = page * static_cast<long long>(PAGE_SIZE);
+        long long end = std::min(last, base + static_cast<long long>(PAGE_SIZE));
+        const uint8_t* data = pageView(page);
+        if (data == nullptr) {
+            data = blankView;
+        }
+
+        if (identity) {
+            // Codificación identidad: la página ya es el texto (la blanca compartida incluida)
+            segments[count++] = {reinterpret_cast<const char*>(data + (position - base)),
+                                 static_cast<size_t>(end - position)};
+            total += end - position;
+            if (count == OUTPUT_SEGMENTS) {
+                writeSegments(fd, segments, count);
+                count = 0;
+            }
+        } else {
+            for (long long i = position; i < end; i++) {
+                buffer += codec().decode(data[i - base]);
+            }
+            if (buffer.size() >= OUTPUT_BUFFER) {
+                segments[0] = {buffer.data(), buffer.size()};
+                writeSegments(fd, segments, 1);
+                total += static_cast<long long>(buffer.size());
+                buffer.clear();
+            }
+        }
+        position = end;
+    }
+
+    if (!buffer.empty()) {
+        segments[count++] = {buffer.data(), buffer.size()};
+        total += static_cast<long long>(buffer.size());
+    }
+    if (!terminator.empty()) {
+        if (count == OUTPUT_SEGMENTS) {
+            writeSegments(fd, segments, count);
+            count = 0;
+        }
+        segments[count++] = {terminator.data(), terminator.size()};
+        total += static_cast<long long>(terminator.size());
+    }
+    if (count > 0) {
+        writeSegments(fd, segments, count);
+    }
+    return total;
+}
+
+std::string Tape::getWindow(long long radius, bool markHead) const {
+    long long first = std::max(cursor->leftEdge, cursor->head - radius);
+    long long last = std::min(cursor->rightEdge, cursor->head + radius + 1);
+
+    std::string result = first > cursor->leftEdge ? "…" : "";
+    if (markHead) {
+        result += decodeRange(first, cursor->head);
+        result += "|" + codec().decode(readCode()) + "|";
+        result += decodeRange(cursor->head + 1, last);
+    } else {
+        result += decodeRange(first, last);
+    }
+    if (last < cursor->rightEdge) {
+        result += "…";
     }
     return result;
 }
 
-void Tape::reset(const std::string& initialContent) {
-    cells.clear();
-    headPosition = 0;
-    
-    for (char c : initialContent) {
-        cells.push_back(std::string(1, c));
+bool Tape::getNonBlankBounds(long long& first, long long& last) const {
+    if (!nonBlankExtent(first, last)) {
+        return false;
     }
-    for (int i = 0; i < 10; i++) {
-        cells.push_back(blankSymbol);
+    first -= cursor->leftEdge;
+    last -= cursor->leftEdge;
+    return true;
+}
+
+long long Tape::getCellsReached() const {
+    return cursor->rightEdge - cursor->leftEdge;
+}
+
+void Tape::reset(const std::string& initialContent) {
+    load(initialContent, 0);
+    cursor->rightEdge = std::max(cursor->rightEdge, static_cast<long long>(initialContent.size()) + INITIAL_PADDING);
+    if (budget != nullptr) {
+        budget->checkTapeCells(cursor->rightEdge - cursor->leftEdge);
     }
 }
 
-void Tape::expandIfNeeded() {
-    if (headPosition < 0) {
-        // Expandir hacia la izquierda con push_front O(1) amortizado
-        int cellsToAdd = -headPosition;
-        for (int i = 0; i < cellsToAdd; i++) {
-            cells.push_front(blankSymbol);
+void Tape::load(const std::string& cellContent, long long headIndex) {
+    releasePages();
+    input = nullptr;
+    streamEnd = NOT_STREAMING;
+    cursor->head = headIndex;
+    cursor->leftEdge = 0;
+    cursor->rightEdge = std::max(static_cast<long long>(cellContent.size()), cursor->head + 1);
+
+    // La extensión se calcula en la primera consulta, solo sobre el contenido cargado
+    cursor->nonBlankFirst = 0;
+    cursor->nonBlankLast = static_cast<long long>(cellContent.size()) - 1;
+    boundsStale = true;
+
+    // Copiar por páginas; las páginas completamente blancas no se crean
+    const uint8_t* source = reinterpret_cast<const uint8_t*>(cellContent.data());
+    const size_t length = cellContent.size();
+    for (size_t offset = 0; offset < length; offset += PAGE_SIZE) {
+        size_t chunk = std::min(PAGE_SIZE, length - offset);
+        if (SimdKernels::findFirstNotEqual(source + offset, chunk, blankCode) == chunk) {
+            continue;
         }
-        headPosition = 0;
+        uint8_t* data = residentPage(static_cast<long long>(offset / PAGE_SIZE), true);
+        std::memcpy(data, source + offset, chunk);
     }
-    if (headPosition >= (int)cells.size()) {
-        // Expandir hacia la derecha
-        while (headPosition >= (int)cells.size()) {
-            cells.push_back(blankSymbol);
-        }
+    refreshCursor();
+}
+
+void Tape::attachInput(InputSource* source, bool releaseBehind) {
+    load("", 0);
+    input = source;
+    streamEnd = 0;
+    releaseConsumed = releaseBehind;
+    fillInput();
+    if (budget != nullptr) {
+        budget->checkTapeCells(cursor->rightEdge - cursor->leftEdge);
     }
 }
 
+void Tape::fillInput() {
+    if (releaseConsumed) {
+        releasePagesBefore(pageOf(cursor->head));
+    }
+
+    // Leer directamente sobre la página, sin pasar por un búfer intermedio
+    // (residentPage() no vuelca la página que devuelve aunque el cabezal aún
+    // no haya pasado a ella)
+    const long long page = pageOf(streamEnd);
+    const size_t offset = static_cast<size_t>(streamEnd - page * static_cast<long long>(PAGE_SIZE));
+    uint8_t* data = residentPage(page, true);
+    const size_t count = input->read(data + offset, PAGE_SIZE - offset);
+    // Dejar en blanco el salto de línea que read() retiene en la página
+    const size_t held = std::min(InputSource::MAX_HELD, PAGE_SIZE - offset - count);
+    std::memset(data + offset + count, blankCode, held);
+    if (count == 0) {
+        // Fin de la entrada: los blancos de relleno como en reset()
+        cursor->rightEdge = std::max(cursor->rightEdge, streamEnd + INITIAL_PADDING);
+        input = nullptr;
+        streamEnd = NOT_STREAMING;
+        return;
+    }
+
+    // Como en load(), la extensión exacta se calcula en la primera consulta
+    const long long last = streamEnd + static_cast<long long>(count) - 1;
+    if (cursor->nonBlankFirst > cursor->nonBlankLast) {
+        cursor->nonBlankFirst = streamEnd;
+    }
+    cursor->nonBlankLast = last;
+    boundsStale = true;
+    streamEnd = last + 1;
+    cursor->rightEdge = std::max(cursor->rightEdge, streamEnd);
+}
+
 bool Tape::isValidSymbol(const std::string& symbol) const {
     if (tapeAlphabet == nullptr) {
         return true;  // Sin alfabeto, todos los símbolos son válidos
     }
     return tapeAlphabet->contains(symbol);
 }
+
+void Tape::enableSpill(size_t maxResident, const std::string& directory) {
+    if (spill == nullptr) {
+        spill = new TapeSpill(directory, PAGE_SIZE);
+    }
+    maxResidentPages = std::max<size_t>(maxResident, 1);
+    enforceResidentLimit(cursor->page);
+}
+
+size_t Tape::getResidentPages() const {
+    return residentPages;
+}
+
+size_t Tape::getAllocatedPages() const {
+    size_t count = 0;
+    for (const auto& page : directory) {
+        if (page.data != nullptr || page.spillSlot >= 0) {
+            count++;
+        }
+    }
+    return count;
+}
+
+const Alphabet& Tape::codec() const {
+    static const Alphabet identity;
+    return tapeAlphabet != nullptr ? *tapeAlphabet : identity;
+}
+
+uint8_t Tape::readCode() const {
+    if (pageOf(cursor->head) != cursor->page) {
+        refreshCursor();
+    }
+    return cursor->pageRead[cursor->head - cursor->page * static_cast<long long>(PAGE_SIZE)];
+}
+
+void Tape::writeCode(uint8_t code) {
+    if (pageOf(cursor->head) != cursor->page) {
+        refreshCursor();
+    }
+    if (cursor->pageWrite == nullptr) {
+        // Escribir un blanco en una página blanca no necesita crearla
+        if (cursor->pageRead == blankView && code == blankCode) {
+            return;
+        }
+        cursor->pageWrite = residentPage(cursor->page, true);
+        cursor->pageRead = cursor->pageWrite;
+    }
+    uint8_t& cell = cursor->pageWrite[cursor->head - cursor->page * static_cast<long long>(PAGE_SIZE)];
+    cell = code;
+
+    if (code != blankCode) {
+        if (cursor->nonBlankFirst > cursor->nonBlankLast) {
+            cursor->nonBlankFirst = cursor->head;
+            cursor->nonBlankLast = cursor->head;
+        } else {
+            cursor->nonBlankFirst = std::min(cursor->nonBlankFirst, cursor->head);
+            cursor->nonBlankLast = std::max(cursor->nonBlankLast, cursor->head);
+        }
+    } else if (cursor->head == cursor->nonBlankFirst || cursor->head == cursor->nonBlankLast) {
+        boundsStale = true;
+    }
+}
+
+void Tape::refreshCursor() const {
+    cursor->page = pageOf(cursor->head);
+    cursor->pageRead = pageView(cursor->page);
+    cursor->pageWrite = nullptr;
+    if (cursor->pageRead == nullptr) {
+        cursor->pageRead = blankView;
+    }
+
+    long long index = cursor->page - firstPage;
+    if (index >= 0 && index < static_cast<long long>(directory.size())) {
+        const Page& entry = directory[index];
+        cursor->pageWrite = entry.data;
+        if (spill != nullptr && entry.data != nullptr) {
+            // Marcar como usada recientemente
+            lru.splice(lru.begin(), lru, entry.lruPos);
+        }
+    }
+}
+
+uint8_t* Tape::residentPage(long long page, bool create) {
+    long long index = page - firstPage;
+    if (index < 0 || index >= static_cast<long long>(directory.size())) {
+        if (!create) {
+            return nullptr;
+        }
+        // Ampliar el directorio para cubrir la página
+        Page empty = {nullptr, -1, lru.end()};
+        if (directory.empty()) {
+            firstPage = page;
+            directory.push_back(empty);
+        } else if (index < 0) {
+            directory.insert(directory.begin(), static_cast<size_t>(-index), empty);
+            firstPage = page;
+        } else {
+            directory.resize(static_cast<size_t>(index) + 1, empty);
+        }
+        index = page - firstPage;
+    }
+
+    Page& entry = directory[index];
+    if (entry.data != nullptr) {
+        return entry.data;
+    }
+    if (entry.spillSlot < 0 && !create) {
+        return nullptr;
+    }
+
+    if (budget != nullptr) {
+        budget->chargeBytes(static_cast<long long>(PAGE_SIZE));
+    }
+    entry.data = arena->allocate();
+    if (entry.spillSlot >= 0) {
+        // Traer de vuelta una página volcada
+        std::memcpy(entry.data, spill->view(entry.spillSlot), PAGE_SIZE);
+        spill->release(entry.spillSlot);
+        entry.spillSlot = -1;
+    } else {
+        std::memset(entry.data, blankCode, PAGE_SIZE);
+    }
+    residentPages++;
+    if (spill != nullptr) {
+        lru.push_front(page);
+        entry.lruPos = lru.begin();
+    }
+    if (page == cursor->page) {
+        cursor->pageRead = entry.data;
+        cursor->pageWrite = entry.data;
+    }
+    enforceResidentLimit(page);
+    return entry.data;
+}
+
+const uint8_t* Tape::pageView(long long page) const {
+    long long index = page - firstPage;
+    if (index < 0 || index >= static_cast<long long>(directory.size())) {
+        return nullptr;
+    }
+    const Page& entry = directory[index];
+    if (entry.data != nullptr) {
+        return entry.data;
+    }
+    if (entry.spillSlot >= 0) {
+        return spill->view(entry.spillSlot);
+    }
+    return nullptr;
+}
+
+void Tape::enforceResidentLimit(long long keep) {
+    if (spill == nullptr) {
+        return;
+    }
+    if (lru.size() != residentPages) {
+        // El volcado se activó con páginas ya creadas: incorporarlas a la lista
+        lru.clear();
+        for (size_t i = 0; i < directory.size(); i++) {
+            if (directory[i].data != nullptr) {
+                lru.push_back(firstPage + static_cast<long long>(i));
+                directory[i].lruPos = std::prev(lru.end());
+            }
+        }
+    }
+    while (residentPages > maxResidentPages) {
+        // Ni la página bajo el cabezal ni la que se acaba de traer se vuelcan
+        auto victim = lru.end();
+        do {
+            if (victim == lru.begin()) {
+                return;
+            }
+            victim = std::prev(victim);
+        } while (*victim == cursor->page || *victim == keep);
+        Page& entry = directory[*victim - firstPage];
+        entry.spillSlot = spill->store(entry.data);
+        arena->release(entry.data);
+        entry.data = nullptr;
+        lru.erase(victim);
+        residentPages--;
+        if (budget != nullptr) {
+            budget->releaseBytes(static_cast<long long>(PAGE_SIZE));
+        }
+    }
+}
+
+void Tape::releasePages() {
+    for (auto& entry : directory) {
+        if (entry.data != nullptr) {
+            arena->release(entry.data);
+        }
+        if (entry.spillSlot >= 0) {
+            spill->release(entry.spillSlot);
+        }
+    }
+    if (budget != nullptr) {
+        budget->releaseBytes(static_cast<long long>(residentPages * PAGE_SIZE));
+    }
+    directory.clear();
+    lru.clear();
+    firstPage = 0;
+    releasedEnd = 0;
+    residentPages = 0;
+    cursor->page = 0;
+    cursor->pageRead = blankView;
+    cursor->pageWrite = nullptr;
+}
+
+void Tape::releasePagesBefore(long long page) {
+    const long long count = std::min(page - firstPage, static_cast<long long>(directory.size()));
+    if (count <= 0) {
+        return;
+    }
+    for (long long i = 0; i < count; i++) {
+        Page& entry = directory[i];
+        if (entry.data != nullptr) {
+            arena->release(entry.data);
+            residentPages--;
+            if (budget != nullptr) {
+                budget->releaseBytes(static_cast<long long>(PAGE_SIZE));
+            }
+            if (spill != nullptr) {
+                lru.erase(entry.lruPos);
+            }
+        }
+        if (entry.spillSlot >= 0) {
+            spill->release(entry.spillSlot);
+        }
+    }
+    directory.erase(directory.begin(), directory.begin() + count);
+    firstPage += count;
+
+    // Las celdas liberadas se leen como blanco: la extensión empieza como pronto aquí
+    const long long start = page * static_cast<long long>(PAGE_SIZE);
+    releasedEnd = std::max(releasedEnd, start);
+    if (cursor->nonBlankFirst < start) {
+        cursor->nonBlankFirst = start;
+        boundsStale = true;
+    }
+}
+
+bool Tape::nonBlankExtent(long long& first, long long& last) const {
+    if (boundsStale) {
+        // Los nuevos extremos solo pueden estar dentro de la extensión anterior
+        long long newFirst = 0;
+        long long newLast = -1;
+        if (cursor->nonBlankFirst <= cursor->nonBlankLast &&
+            !scanNonBlankBounds(cursor->nonBlankFirst, cursor->nonBlankLast + 1, newFirst, newLast)) {
+            newFirst = 0;
+            newLast = -1;
+        }
+        cursor->nonBlankFirst = newFirst;
+        cursor->nonBlankLast = newLast;
+        boundsStale = false;
+    }
+    first = cursor->nonBlankFirst;
+    last = cursor->nonBlankLast;
+    return first <= last;
+}
+
+bool Tape::scanNonBlankBounds(long long rangeStart, long long rangeEnd, long long& first, long long& last) const {
+    // Encontrar el primer y último símbolo no-blanco recorriendo solo páginas creadas
+    first = rangeEnd;
+    for (long long page = pageOf(rangeStart); page <= pageOf(rangeEnd - 1); page++) {
+        const uint8_t* data = pageView(page);
+        if (data == nullptr) {
+            continue;
+        }
+        long long base = page * static_cast<long long>(PAGE_SIZE);
+        long long from = std::max(rangeStart, base) - base;
+        long long to = std::min(rangeEnd, base + static_cast<long long>(PAGE_SIZE)) - base;
+        size_t found = SimdKernels::findFirstNotEqual(data + from, to - from, blankCode);
+        if (found != static_cast<size_t>(to - from)) {
+            first = base + from + found;
+            break;
+        }
+    }
+    if (first == rangeEnd) {
+        return false;
+    }
+
+    last = first;
+    for (long long page = pageOf(rangeEnd - 1); page >= pageOf(first); page--) {
+        const uint8_t* data = pageView(page);
+        if (data == nullptr) {
+            continue;
+        }
+        long long base = page * static_cast<long long>(PAGE_SIZE);
+        long long from = std::max(first, base) - base;
+        long long to = std::min(rangeEnd, base + static_cast<long long>(PAGE_SIZE)) - base;
+        size_t found = SimdKernels::findLastNotEqual(data + from, to - from, blankCode);
+        if (found != static_cast<size_t>(to - from)) {
+            last = base + from + found;
+            break;
+        }
+    }
+    return true;
+}
+
+void Tape::copyCodes(long long first, long long last, uint8_t* out) const {
+    long long position = first;
+    while (position < last) {
+        long long page = pageOf(position);
+        long long base = page * static_cast<long long>(PAGE_SIZE);
+        long long end = std::min(last, base + static_cast<long long>(PAGE_SIZE));
+        const uint8_t* data = pageView(page);
+        if (data == nullptr) {
+            std::memset(out, blankCode, static_cast<size_t>(end - position));
+        } else {
+            std::memcpy(out, data + (position - base), static_cast<size_t>(end - position));
+        }
+        out += end - position;
+        position = end;
+    }
+}
+
+long long Tape::countRun(long long from, int direction, long long limit, const ByteSet& set) const {
+    const long long size = static_cast<long long>(PAGE_SIZE);
+    const bool blankInSet = set.contains(blankCode);
+    const long long lastPage = firstPage + static_cast<long long>(directory.size()) - 1;
+    long long count = 0;
+    long long position = from;
+    while (count < limit) {
+        const long long page = pageOf(position);
+        if (directory.empty() || (direction > 0 && page > lastPage) || (direction < 0 && page < firstPage)) {
+            // Más allá del directorio todo es blanco
+            return blankInSet ? limit : count;
+        }
+        const long long offset = position - page * size;
+        const long long length = std::min(limit - count, direction > 0 ? size - offset : offset + 1);
+        const uint8_t* data = pageView(page);
+        long long inSet;
+        if (data == nullptr) {
+            inSet = blankInSet ? length : 0;
+        } else if (direction > 0) {
+            inSet = static_cast<long long>(
+                SimdKernels::findFirstNotInSet(data + offset, static_cast<size_t>(length), set));
+        } else {
+            const uint8_t* first = data + (offset - length + 1);
+            const size_t last = SimdKernels::findLastNotInSet(first, static_cast<size_t>(length), set);
+            inSet = last == static_cast<size_t>(length) ? length : length - 1 - static_cast<long long>(last);
+        }
+        count += inSet;
+        if (inSet < length) {
+            return count;
+        }
+        position += direction > 0 ? length : -length;
+    }
+    return count;
+}
+
+void Tape::writeCodes(long long first, const uint8_t* codes, long long count) {
+    const long long size = static_cast<long long>(PAGE_SIZE);
+    long long position = first;
+    const long long last = first + count;
+    while (position < last) {
+        const long long page = pageOf(position);
+        const long long base = page * size;
+        const long long end = std::min(last, base + size);
+        const size_t length = static_cast<size_t>(end - position);
+        const size_t firstMark = SimdKernels::findFirstNotEqual(codes, length, blankCode);
+        uint8_t* data = residentPage(page, false);
+        if (data == nullptr && firstMark == length) {
+            // Solo blancos sobre una página blanca: como en writeCode(), nada que hacer
+            codes += length;
+            position = end;
+            continue;
+        }
+        if (data == nullptr) {
+            data = residentPage(page, true);
+        }
+        // Con volcado a disco residentPage() no vuelca la página que devuelve,
+        // aunque el cabezal esté en otra
+        std::memcpy(data + (position - base), codes, length);
+
+        // Blancos sobre un extremo de la extensión no blanca: se recalcula al consultarla
+        const bool hasBlank = std::memchr(codes, blankCode, length) != nullptr;
+        if (hasBlank && ((cursor->nonBlankFirst >= position && cursor->nonBlankFirst < end) ||
+                         (cursor->nonBlankLast >= position && cursor->nonBlankLast < end))) {
+            boundsStale = true;
+        }
+        if (firstMark < length) {
+            const long long markFirst = position + static_cast<long long>(firstMark);
+            const long long markLast = position + static_cast<long long>(
+                SimdKernels::findLastNotEqual(codes, length, blankCode));
+            if (cursor->nonBlankFirst > cursor->nonBlankLast) {
+                cursor->nonBlankFirst = markFirst;
+                cursor->nonBlankLast = markLast;
+            } else {
+                cursor->nonBlankFirst = std::min(cursor->nonBlankFirst, markFirst);
+                cursor->nonBlankLast = std::max(cursor->nonBlankLast, markLast);
+            }
+        }
+        codes += length;
+        position = end;
+    }
+}
+
+long long Tape::getLoadedReach(int direction) const {
+    if (direction > 0 && input != nullptr) {
+        return std::max(0LL, streamEnd - 1 - cursor->head);
+    }
+    return std::numeric_limits<long long>::max();
+}
+
+void Tape::advanceHead(long long cells) {
+    cursor->head += cells;
+    if (cursor->head >= cursor->rightEdge || cursor->head < cursor->leftEdge) {
+        cursor->rightEdge = std::max(cursor->rightEdge, cursor->head + 1);
+        cursor->leftEdge = std::min(cursor->leftEdge, cursor->head);
+        if (budget != nullptr) {
+            budget->checkTapeCells(cursor->rightEdge - cursor->leftEdge);
+        }
+    }
+}
+
+std::string Tape::decodeRange(long long first, long long last) const {
+    std::string result;
+    const bool identity = !codec().hasMultiCharSymbols();
+    if (identity) {
+        result.reserve(static_cast<size_t>(last - first));
+    }
+    const std::string& blankText = codec().decode(blankCode);
+
+    long long position = first;
+    while (position < last) {
+        long long page = pageOf(position);
+        long long base = page * static_cast<long long>(PAGE_SIZE);
+        long long end = std::min(last, base + static_cast<long long>(PAGE_SIZE));
+        const uint8_t* data = pageView(page);
+        if (data == nullptr) {
+            for (long long i = position; i < end; i++) {
+                result += blankText;
+            }
+        } else if (identity) {
+            // Codificación identidad: copia directa de la página
+            result.append(reinterpret_cast<const char*>(data + (position - base)),
+                          static_cast<size_t>(end - position));
+        } else {
+            for (long long i = position; i < end; i++) {
+                result += codec().decode(data[i - base]);
+            }
+        }
+        position = end;
+    }
+    return result;
+}
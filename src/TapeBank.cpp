@@ -0,0 +1,42 @@
+#include "../include/TapeBank.h"
+
+TapeBank::TapeBank() : count(0), cursors(nullptr), arena(Tape::PAGE_SIZE) {
+}
+
+TapeBank::~TapeBank() {
+    // Las cintas devuelven sus páginas a la reserva antes de que se destruya
+    clear();
+    delete[] cursors;
+}
+
+void TapeBank::resize(int n) {
+    clear();
+    delete[] cursors;
+    count = n;
+    cursors = new TapeCursor[n];
+    tapes.assign(n, nullptr);
+    blankCodes.assign(n, 0);
+    blankViews.assign(n, nullptr);
+}
+
+void TapeBank::prepare(int i, const std::string& content, const std::string& blank,
+                       const Alphabet* alphabet, ResourceBudget* budget) {
+    if (tapes[i] != nullptr && tapes[i]->getBlankSymbol() != blank) {
+        delete tapes[i];
+        tapes[i] = nullptr;
+    }
+    if (tapes[i] != nullptr) {
+        tapes[i]->reset(content);
+    } else {
+        tapes[i] = new Tape(content, blank, alphabet, budget, &cursors[i], &arena);
+        blankCodes[i] = tapes[i]->getBlankCode();
+        blankViews[i] = arena.blankPage(blankCodes[i]);
+    }
+}
+
+void TapeBank::clear() {
+    for (auto& tape : tapes) {
+        delete tape;
+        tape = nullptr;
+    }
+}
@@ -0,0 +1,170 @@
+#include "../include/TapePrimitives.h"
+#include "../include/TransitionTable.h"
+#include <algorithm>
+#include <iterator>
+
+bool TapePrimitives::detect(const TransitionTable& table, size_t index, const std::vector<uint8_t>& symbols,
+                            long long& lookups, Primitive& result) {
+    const TransitionTable::Entry& entry = table.getEntry(index);
+    if (entry.next != entry.state || !entry.encodable || table.isAccepting(entry.state)) {
+        return false;
+    }
+    const int tapes = table.getTapeCount();
+    const uint8_t* reads = table.getReadCodes(entry);
+    const uint8_t* writes = table.getWriteCodes(entry);
+    const int8_t* moves = table.getMoves(entry);
+    std::vector<int> moving;
+    for (int i = 0; i < tapes; i++) {
+        if (moves[i] != 0) {
+            moving.push_back(i);
+        } else if (writes[i] != reads[i]) {
+            return false;
+        }
+    }
+    if (moving.empty() || moving.size() > 2) {
+        return false;
+    }
+
+    // El bucle sigue con los códigos leídos si su transición vuelve al estado con
+    // los mismos movimientos, no cambia nada y, en la copia, escribe el origen en el destino
+    std::vector<uint8_t> probe(reads, reads + tapes);
+    auto continues = [&](int from, int to) {
+        const TransitionTable::Entry* next = table.find(entry.state, probe.data());
+        if (next == nullptr || next->next != entry.state || !next->encodable) {
+            return false;
+        }
+        const uint8_t* nextWrites = table.getWriteCodes(*next);
+        const int8_t* nextMoves = table.getMoves(*next);
+        for (int i = 0; i < tapes; i++) {
+            if (nextMoves[i] != moves[i] || nextWrites[i] != (i == to ? probe[from] : probe[i])) {
+                return false;
+            }
+        }
+        return true;
+    };
+    // Símbolos de la cinta a con los que el bucle continúa (b lee lo mismo si compare)
+    auto collect = [&](int a, int b, int to, bool compare) {
+        result.codes.clear();
+        for (uint8_t code : symbols) {
+            if (lookups-- <= 0) {
+                return false;
+            }
+            probe[a] = code;
+            if (compare) {
+                probe[b] = code;
+            }
+            if (continues(a, to)) {
+                result.codes.insert(code);
+            }
+        }
+        return result.codes.contains(reads[a]);
+    };
+
+    const int a = moving[0];
+    if (moving.size() == 1) {
+        result = Primitive{Kind::Seek, a, -1, moves[a], 0, 0, ByteSet()};
+        return writes[a] == reads[a] && collect(a, -1, -1, false);
+    }
+    const int b = moving[1];
+    const int pairs[2][2] = {{a, b}, {b, a}};
+    for (const auto& pair : pairs) {
+        const int from = pair[0];
+        const int to = pair[1];
+        if (writes[from] == reads[from] && writes[to] == reads[from] && reads[to] != reads[from]) {
+            result = Primitive{Kind::Copy, from, to, moves[from], moves[to], reads[to], ByteSet()};
+            return collect(from, to, to, false);
+        }
+    }
+    if (reads[a] == reads[b] && writes[a] == reads[a] && writes[b] == reads[b]) {
+        result = Primitive{Kind::Compare, a, b, moves[a], moves[b], 0, ByteSet()};
+        return collect(a, b, -1, true);
+    }
+    return false;
+}
+
+long long TapePrimitives::execute(const TransitionTable& table, int state, TapeBank& tapes, uint8_t* codes,
+                                  std::vector<uint8_t>& scratch, long long maxSteps) {
+    if (maxSteps <= 0 || !table.startsPrimitive(state)) {
+        return 0;
+    }
+    tapes.readCodes(codes);
+    const TransitionTable::Entry* entry = table.find(state, codes);
+    if (entry == nullptr || entry->primitive < 0) {
+        return 0;
+    }
+    return run(table.getPrimitive(*entry), tapes, scratch, maxSteps);
+}
+
+long long TapePrimitives::run(const Primitive& primitive, TapeBank& tapes, std::vector<uint8_t>& scratch,
+                              long long maxSteps) {
+    Tape& source = *tapes[primitive.source];
+    const long long sourceHead = source.getHeadIndex();
+    long long limit = std::min(maxSteps, source.getLoadedReach(primitive.sourceMove));
+    if (primitive.target >= 0) {
+        limit = std::min(limit, tapes[primitive.target]->getLoadedReach(primitive.targetMove));
+    }
+    long long steps = source.countRun(sourceHead, primitive.sourceMove, limit, primitive.codes);
+    if (primitive.kind == Kind::Seek) {
+        source.advanceHead(steps * primitive.sourceMove);
+        return steps;
+    }
+
+    // Celdas [first, first + length) que visitan los pasos [done, done + length) moviéndose en move
+    auto span = [](long long head, int move, long long done, long long length) {
+        return move > 0 ? head + done : head - done - length + 1;
+    };
+    Tape& target = *tapes[primitive.target];
+    const long long targetHead = target.getHeadIndex();
+    const bool reversed = primitive.sourceMove != primitive.targetMove;
+    if (scratch.size() < static_cast<size_t>(2 * BLOCK)) {
+        // Una sola vez por ejecutor: después el bucle no reserva memoria
+        scratch.resize(static_cast<size_t>(2 * BLOCK));
+    }
+    uint8_t* block = scratch.data();
+    if (primitive.kind == Kind::Copy) {
+        ByteSet targetCodes;
+        targetCodes.insert(primitive.targetCode);
+        steps = target.countRun(targetHead, primitive.targetMove, steps, targetCodes);
+        for (long long done = 0; done < steps; done += BLOCK) {
+            const long long length = std::min(BLOCK, steps - done);
+            source.copyCodes(span(sourceHead, primitive.sourceMove, done, length),
+                             span(sourceHead, primitive.sourceMove, done, length) + length, block);
+            if (reversed) {
+                std::reverse(block, block + length);
+            }
+            target.writeCodes(span(targetHead, primitive.targetMove, done, length), block, length);
+        }
+    } else {
+        // Comparación: dentro del tramo de símbolos válidos, hasta la primera diferencia
+        uint8_t* other = block + BLOCK;
+        long long matched = 0;
+        while (matched < steps) {
+            const long long length = std::min(BLOCK, steps - matched);
+            const long long sourceFirst = span(sourceHead, primitive.sourceMove, matched, length);
+            const long long targetFirst = span(targetHead, primitive.targetMove, matched, length);
+            source.copyCodes(sourceFirst, sourceFirst + length, block);
+            target.copyCodes(targetFirst, targetFirst + length, other);
+            if (reversed) {
+                std::reverse(other, other + length);
+            }
+            long long equal;
+            if (primitive.sourceMove > 0) {
+                equal = std::mismatch(block, block + length, other).first - block;
+            } else {
+                // Los dos bloques van en orden de celdas: los pasos los recorren desde el final
+                using Backwards = std::reverse_iterator<const uint8_t*>;
+                const Backwards end(block);
+                equal = std::mismatch(Backwards(block + length), end, Backwards(other + length)).first -
+                        Backwards(block + length);
+            }
+            matched += equal;
+            if (equal < length) {
+                break;
+            }
+        }
+        steps = matched;
+    }
+    source.advanceHead(steps * primitive.sourceMove);
+    target.advanceHead(steps * primitive.targetMove);
+    return steps;
+}
@@ -0,0 +1,95 @@
+#include "../include/TapeSpill.h"
+#include "../include/MTException.h"
+#include <cstring>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstdlib>
+#endif
+
+namespace {
+
+// Páginas por bloque proyectado
+const size_t PAGES_PER_CHUNK = 64;
+
+}  // namespace
+
+#ifndef _WIN32
+
+TapeSpill::TapeSpill(const std::string& directory, size_t pageBytes)
+    : fileDescriptor(-1), pageSize(pageBytes), chunkBytes(pageBytes * PAGES_PER_CHUNK),
+      slotCount(0) {
+    std::string pattern = (directory.empty() ? std::string(".") : directory) + "/mtspill-XXXXXX";
+    std::vector<char> path(pattern.begin(), pattern.end());
+    path.push_back('\0');
+
+    fileDescriptor = mkstemp(path.data());
+    if (fileDescriptor < 0) {
+        throw MTException("No se pudo crear el archivo de volcado de cinta en: " + directory);
+    }
+    // El archivo desaparece al cerrarse el descriptor
+    unlink(path.data());
+}
+
+TapeSpill::~TapeSpill() {
+    for (uint8_t* chunk : chunks) {
+        munmap(chunk, chunkBytes);
+    }
+    if (fileDescriptor >= 0) {
+        close(fileDescriptor);
+    }
+}
+
+void TapeSpill::growFile() {
+    off_t newSize = static_cast<off_t>((chunks.size() + 1) * chunkBytes);
+    if (ftruncate(fileDescriptor, newSize) != 0) {
+        throw MTException("No se pudo ampliar el archivo de volcado de cinta");
+    }
+    void* mapping = mmap(nullptr, chunkBytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                         fileDescriptor, static_cast<off_t>(chunks.size() * chunkBytes));
+    if (mapping == MAP_FAILED) {
+        throw MTException("No se pudo proyectar el archivo de volcado de cinta");
+    }
+    chunks.push_back(static_cast<uint8_t*>(mapping));
+}
+
+#else
+
+TapeSpill::TapeSpill(const std::string& directory, size_t pageBytes)
+    : fileDescriptor(-1), pageSize(pageBytes), chunkBytes(pageBytes * PAGES_PER_CHUNK),
+      slotCount(0) {
+    throw MTException("El volcado de cinta a disco no está disponible en esta plataforma: " + directory);
+}
+
+TapeSpill::~TapeSpill() {
+}
+
+void TapeSpill::growFile() {
+}
+
+#endif
+
+long long TapeSpill::store(const uint8_t* data) {
+    long long slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        slot = slotCount++;
+        if (static_cast<size_t>(slot) / PAGES_PER_CHUNK >= chunks.size()) {
+            growFile();
+        }
+    }
+    std::memcpy(const_cast<uint8_t*>(view(slot)), data, pageSize);
+    return slot;
+}
+
+const uint8_t* TapeSpill::view(long long slot) const {
+    return chunks[static_cast<size_t>(slot) / PAGES_PER_CHUNK] +
+           (static_cast<size_t>(slot) % PAGES_PER_CHUNK) * pageSize;
+}
+
+void TapeSpill::release(long long slot) {
+    freeSlots.push_back(slot);
+}
@@ -0,0 +1,216 @@
+#include "../include/TraceWriter.h"
+#include "../include/ConfigurationStream.h"
+#include "../include/RunStats.h"
+#include "../include/MTException.h"
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Semilla del muestreo: la misma ejecución da siempre la misma muestra
+const unsigned long long SAMPLE_SEED = 0x5eed7ace5eed7aceULL;
+
+const long long NEVER = std::numeric_limits<long long>::max();
+
+/**
+ * Campo CSV, entre comillas solo si contiene separadores, comillas o saltos de línea
+ */
+void appendCsvField(std::string& out, const std::string& field) {
+    if (field.find_first_of(",\"\r\n") == std::string::npos) {
+        out += field;
+        return;
+    }
+    out += '"';
+    for (char c : field) {
+        if (c == '"') {
+            out += '"';
+        }
+        out += c;
+    }
+    out += '"';
+}
+
+}  // namespace
+
+TraceWriter::TraceWriter(int fd, TraceFormat format)
+    : fd(fd), outputFormat(format), stride(1), sampleSize(0), runIndex(0), headerWritten(false),
+      nextStep(NEVER), lastWritten(-1), random(SAMPLE_SEED), weight(0.0) {
+    buffer.reserve(BUFFER_SIZE + BUFFER_SIZE / 4);
+}
+
+TraceWriter::~TraceWriter() {
+    try {
+        flush();
+    } catch (const MTException&) {
+        // El destino ya no admite escrituras; no hay a quién informar
+    }
+}
+
+bool TraceWriter::parseFormat(const std::string& name, TraceFormat& result) {
+    if (name == "text") {
+        result = TraceFormat::Text;
+    } else if (name == "csv") {
+        result = TraceFormat::Csv;
+    } else if (name == "jsonl") {
+        result = TraceFormat::Jsonl;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void TraceWriter::setStride(long long k) {
+    stride = k > 0 ? k : 1;
+}
+
+void TraceWriter::setSampleSize(size_t n) {
+    sampleSize = n;
+}
+
+void TraceWriter::begin(const TuringMachine& tm) {
+    if (fd == 1) {
+        // Se escribe en el descriptor directamente: antes, lo que haya pendiente en std::cout
+        std::cout << std::flush;
+    }
+    runIndex++;
+    samples.clear();
+    if (outputFormat == TraceFormat::Text) {
+        buffer += "\n=== Traza de Ejecución";
+        if (sampleSize > 0) {
+            buffer += " (muestra de " + std::to_string(sampleSize) + " configuraciones";
+            buffer += stride > 1 ? " entre una de cada " + std::to_string(stride) + " pasos)" : ")";
+        } else if (stride > 1) {
+            buffer += " (cada " + std::to_string(stride) + " pasos)";
+        }
+        buffer += " ===\n";
+    } else if (outputFormat == TraceFormat::Csv && !headerWritten) {
+        buffer += "ejecucion,paso,estado,cinta,contenido,cabezal\n";
+        headerWritten = true;
+    }
+
+    format(tm, buffer);
+    lastWritten = tm.getStepCount();
+    nextStep = lastWritten + stride;
+    flushIfFull();
+}
+
+void TraceWriter::take(const TuringMachine& tm) {
+    const long long step = tm.getStepCount();
+    if (sampleSize == 0) {
+        format(tm, buffer);
+        lastWritten = step;
+        nextStep = step + stride;
+        flushIfFull();
+        return;
+    }
+
+    // Algoritmo L: se llenan las n plazas y después cada paso calculado sustituye a una al azar
+    if (samples.size() < sampleSize) {
+        samples.push_back(Sample{step, std::string()});
+        format(tm, samples.back().line);
+        if (samples.size() < sampleSize) {
+            nextStep = step + stride;
+        } else {
+            weight = 1.0;
+            nextStep = skipAfter(step);
+        }
+        return;
+    }
+    Sample& replaced = samples[std::uniform_int_distribution<size_t>(0, sampleSize - 1)(random)];
+    replaced.step = step;
+    replaced.line.clear();
+    format(tm, replaced.line);
+    nextStep = skipAfter(step);
+}
+
+long long TraceWriter::skipAfter(long long step) {
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    const double n = static_cast<double>(sampleSize);
+    // 1 - u está en (0, 1]: los logaritmos son finitos o cero
+    weight *= std::exp(std::log(1.0 - uniform(random)) / n);
+    const double skip = std::floor(std::log(1.0 - uniform(random)) / std::log1p(-weight));
+    const double next = static_cast<double>(step) + (skip + 1.0) * static_cast<double>(stride);
+    if (!(next < static_cast<double>(NEVER))) {
+        return NEVER;
+    }
+    return static_cast<long long>(next);
+}
+
+void TraceWriter::finish(const TuringMachine& tm) {
+    const long long step = tm.getStepCount();
+    std::sort(samples.begin(), samples.end(),
+              [](const Sample& a, const Sample& b) { return a.step < b.step; });
+    for (const Sample& sample : samples) {
+        if (sample.step != step) {
+            buffer += sample.line;
+            lastWritten = sample.step;
+            flushIfFull();
+        }
+    }
+    samples.clear();
+
+    if (lastWritten != step) {
+        format(tm, buffer);
+        lastWritten = step;
+    }
+    nextStep = NEVER;
+    flush();
+}
+
+void TraceWriter::format(const TuringMachine& tm, std::string& out) const {
+    const ConfigurationView config(&tm);
+    const std::string step = std::to_string(config.step());
+    switch (outputFormat) {
+        case TraceFormat::Text:
+            out += "Paso " + step + ": " + config.toString() + "\n";
+            break;
+        case TraceFormat::Csv:
+            for (int i = 0; i < config.tapeCount(); i++) {
+                out += std::to_string(runIndex) + "," + step + ",";
+                appendCsvField(out, config.state());
+                out += "," + std::to_string(i + 1) + ",";
+                appendCsvField(out, config.tape(i));
+                out += "," + std::to_string(config.head(i)) + "\n";
+            }
+            break;
+        case TraceFormat::Jsonl:
+            out += "{\"run\":" + std::to_string(runIndex) + ",\"step\":" + step +
+                   ",\"state\":" + RunStats::quote(config.state()) + ",\"tapes\":[";
+            for (int i = 0; i < config.tapeCount(); i++) {
+                out += (i > 0 ? ",{\"content\":" : "{\"content\":") + RunStats::quote(config.tape(i)) +
+                       ",\"head\":" + std::to_string(config.head(i)) + "}";
+            }
+            out += "]}\n";
+            break;
+    }
+}
+
+void TraceWriter::flush() {
+    size_t done = 0;
+    while (done < buffer.size()) {
+#ifdef _WIN32
+        int count = _write(fd, buffer.data() + done, static_cast<unsigned>(buffer.size() - done));
+#else
+        ssize_t count = write(fd, buffer.data() + done, buffer.size() - done);
+#endif
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            buffer.clear();
+            throw MTException("No se pudo escribir la traza: " + std::string(std::strerror(errno)));
+        }
+        done += static_cast<size_t>(count);
+    }
+    buffer.clear();
+}
@@ -4,7 +4,7 @@
  * Constructor por defecto
  */
 Transition::Transition()
-    : currentState(State()) {
+    : currentState(State()), id(-1) {
     readSymbols.push_back("");
     writeSymbols.push_back("");
     directions.push_back('R');
@@ -15,7 +15,7 @@ Transition::Transition()
  */
 Transition::Transition(const State& current, const std::string& read,
                        const State& next, const std::string& write, char dir)
-    : currentState(current), nextState(next) {
+    : currentState(current), nextState(next), id(-1) {
     readSymbols.push_back(read);
     writeSymbols.push_back(write);
     directions.push_back(dir);
@@ -28,7 +28,7 @@ Transition::Transition(const State& current, const std::vector<std::string>& rea
                        const State& next, const std::vector<std::string>& write, 
                        const std::vector<char>& dir)
     : currentState(current), readSymbols(read), nextState(next), 
-      writeSymbols(write), directions(dir) {
+      writeSymbols(write), directions(dir), id(-1) {
 }
 
 // Getters monocinta (compatibilidad)
@@ -73,6 +73,14 @@ bool Transition::isMultiTape() const {
     return readSymbols.size() > 1;
 }
 
+int Transition::getId() const {
+    return id;
+}
+
+void Transition::setId(int transitionId) {
+    id = transitionId;
+}
+
 std::string Transition::toString() const {
     if (isMultiTape()) {
         std::string result = currentState.getName() + " [";
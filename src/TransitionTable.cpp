@@ -0,0 +1,354 @@
+#include "../include/TransitionTable.h"
+#include "../include/TuringMachine.h"
+#include "../include/MTException.h"
+#include "../include/SymbolPattern.h"
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+
+// Máximo de entradas de la tabla directa multicinta (4 MB de índices)
+const size_t MAX_DIRECT_ENTRIES = 1 << 20;
+
+// Búsquedas en la tabla que se dedican como mucho a reconocer primitivas
+const long long PRIMITIVE_LOOKUPS = 1 << 22;
+
+}  // namespace
+
+/**
+ * Constructor privado: solo se construye a través de compile()
+ */
+TransitionTable::TransitionTable()
+    : tapes(1), initialState(0), stateStride(256), radix(257), slotMask(0) {
+    symbolIndex.fill(0);
+}
+
+/**
+ * Compila la función de transición
+ *
+ * Los estados se numeran en el orden de Q; los que solo aparecen en q0 o en
+ * las transiciones (máquinas construidas sin validar) se añaden al final.
+ * Una transición que lee un símbolo sin código nunca puede aplicarse y se
+ * omite; si lo que no tiene código es un símbolo escrito, se conserva y el
+ * error se produce al aplicarla, como en la cinta.
+ *
+ * Las transiciones con comodines, clases o referencias (SymbolPattern) se
+ * expanden aquí en transiciones concretas: primero se compilan las explícitas
+ * y después los patrones en orden de precedencia, cada uno solo en las
+ * combinaciones que aún no tienen transición. Las entradas expandidas conservan
+ * el identificador y la transición original del patrón.
+ */
+TransitionTable* TransitionTable::compile(const TuringMachine& tm) {
+    TransitionTable* table = new TransitionTable();
+    table->tapes = tm.getNumberOfTapes();
+
+    std::unordered_map<std::string, int>& ids = table->stateIds;
+    ids.reserve(tm.getStates().size() + 1);
+    auto idOf = [&](const State& state) {
+        auto it = ids.find(state.getName());
+        if (it != ids.end()) {
+            return it->second;
+        }
+        int id = static_cast<int>(table->stateList.size());
+        ids.emplace(state.getName(), id);
+        table->stateList.push_back(state);
+        return id;
+    };
+    for (const auto& state : tm.getStates()) {
+        idOf(state);
+    }
+    table->initialState = idOf(tm.getInitialState());
+
+    const Alphabet& alphabet = tm.getTapeAlphabet();
+    const size_t width = static_cast<size_t>(table->tapes);
+    std::vector<const Transition*> patterns;
+    std::unordered_set<std::string> taken;   // (estado, códigos leídos) con transición
+    auto takenKey = [&](int state, const uint8_t* reads) {
+        std::string key(reinterpret_cast<const char*>(&state), sizeof(state));
+        key.append(reinterpret_cast<const char*>(reads), width);
+        return key;
+    };
+    for (const auto& [key, trans] : tm.getTransitions()) {
+        if (SymbolPattern::isPattern(trans, alphabet)) {
+            patterns.push_back(&trans);
+            continue;
+        }
+        const auto& readSymbols = trans.getReadSymbols();
+        const auto& writeSymbols = trans.getWriteSymbols();
+        const auto& directions = trans.getDirections();
+        if (readSymbols.size() != width || writeSymbols.size() != width || directions.size() != width) {
+            continue;
+        }
+
+        Entry entry = {0, 0, 0, trans.getId(), static_cast<uint32_t>(table->readCodes.size()), true, -1, &trans};
+        std::vector<uint8_t> reads(width);
+        try {
+            for (size_t i = 0; i < width; i++) {
+                reads[i] = alphabet.encode(readSymbols[i]);
+            }
+        } catch (const MTException&) {
+            continue;
+        }
+        entry.key = table->packCodes(reads.data());
+        entry.state = idOf(trans.getCurrentState());
+        entry.next = idOf(trans.getNextState());
+
+        for (size_t i = 0; i < width; i++) {
+            uint8_t code = 0;
+            try {
+                code = alphabet.encode(writeSymbols[i]);
+            } catch (const MTException&) {
+                entry.encodable = false;
+            }
+            table->readCodes.push_back(reads[i]);
+            table->writeCodes.push_back(code);
+            table->moves.push_back(directions[i] == 'R' ? 1 : (directions[i] == 'L' ? -1 : 0));
+        }
+        table->entries.push_back(entry);
+        taken.insert(takenKey(entry.state, reads.data()));
+    }
+
+    std::sort(patterns.begin(), patterns.end(), [&](const Transition* a, const Transition* b) {
+        return SymbolPattern::precedes(*a, *b, alphabet);
+    });
+    for (const Transition* pattern : patterns) {
+        table->expand(*pattern, tm, idOf(pattern->getCurrentState()), idOf(pattern->getNextState()),
+                      [&](int state, const uint8_t* reads) { return taken.insert(takenKey(state, reads)).second; });
+    }
+
+    std::vector<int> acceptingIds;
+    for (const auto& state : tm.getAcceptanceStates()) {
+        acceptingIds.push_back(idOf(state));
+    }
+    table->accepting.assign(table->stateList.size(), 0);
+    for (int id : acceptingIds) {
+        table->accepting[id] = 1;
+    }
+
+    table->buildIndex();
+    table->detectPrimitives(alphabet);
+    return table;
+}
+
+void TransitionTable::buildIndex() {
+    const size_t numStates = stateList.size();
+    if (tapes == 1) {
+        direct.assign(numStates * 256, -1);
+        for (size_t i = 0; i < entries.size(); i++) {
+            const Entry& entry = entries[i];
+            direct[static_cast<size_t>(entry.state) * 256 + readCodes[entry.offset]] = static_cast<int32_t>(i);
+        }
+        return;
+    }
+
+    // Numeración densa de los códigos que aparecen en alguna transición; el
+    // resto comparte el último índice, que nunca tiene transición
+    std::vector<char> used(256, 0);
+    for (uint8_t code : readCodes) {
+        used[code] = 1;
+    }
+    size_t symbols = 0;
+    for (int code = 0; code < 256; code++) {
+        if (used[code]) {
+            symbolIndex[code] = static_cast<uint16_t>(symbols++);
+        }
+    }
+    for (int code = 0; code < 256; code++) {
+        if (!used[code]) {
+            symbolIndex[code] = static_cast<uint16_t>(symbols);
+        }
+    }
+    radix = symbols + 1;
+
+    size_t stride = 1;
+    bool fits = numStates > 0;
+    for (int i = 0; i < tapes && fits; i++) {
+        stride *= radix;
+        fits = stride * numStates <= MAX_DIRECT_ENTRIES;
+    }
+    if (fits) {
+        stateStride = stride;
+        direct.assign(numStates * stride, -1);
+        for (size_t i = 0; i < entries.size(); i++) {
+            const Entry& entry = entries[i];
+            size_t offset = 0;
+            for (int t = tapes; t-- > 0;) {
+                offset = offset * radix + symbolIndex[readCodes[entry.offset + t]];
+            }
+            direct[static_cast<size_t>(entry.state) * stride + offset] = static_cast<int32_t>(i);
+        }
+        return;
+    }
+
+    // Al menos el doble de huecos que transiciones: las sondas son cortas
+    size_t capacity = 16;
+    while (capacity < entries.size() * 2) {
+        capacity *= 2;
+    }
+    slots.assign(capacity, -1);
+    slotMask = capacity - 1;
+    for (size_t i = 0; i < entries.size(); i++) {
+        const Entry& entry = entries[i];
+        size_t slot = hashOf(entry.state, entry.key) & slotMask;
+        while (slots[slot] >= 0) {
+            slot = (slot + 1) & slotMask;
+        }
+        slots[slot] = static_cast<int32_t>(i);
+    }
+}
+
+void TransitionTable::detectPrimitives(const Alphabet& alphabet) {
+    std::vector<uint8_t> symbols;
+    for (const std::string& symbol : alphabet.getSymbols()) {
+        try {
+            symbols.push_back(alphabet.encode(symbol));
+        } catch (const MTException&) {
+            continue;
+        }
+    }
+    primitiveStates.assign(stateList.size(), 0);
+    long long lookups = PRIMITIVE_LOOKUPS;
+    TapePrimitives::Primitive primitive;
+    for (size_t i = 0; i < entries.size() && lookups > 0; i++) {
+        if (TapePrimitives::detect(*this, i, symbols, lookups, primitive)) {
+            entries[i].primitive = static_cast<int32_t>(primitives.size());
+            primitives.push_back(primitive);
+            primitiveStates[static_cast<size_t>(entries[i].state)] = 1;
+        }
+    }
+}
+
+void TransitionTable::expand(const Transition& pattern, const TuringMachine& tm, int state, int next,
+                             const std::function<bool(int, const uint8_t*)>& claim) {
+    const size_t width = static_cast<size_t>(tapes);
+    const auto& readSymbols = pattern.getReadSymbols();
+    const auto& writeSymbols = pattern.getWriteSymbols();
+    const auto& directions = pattern.getDirections();
+    if (readSymbols.size() != width || writeSymbols.size() != width || directions.size() != width) {
+        return;
+    }
+
+    // Códigos candidatos de cada cinta (las referencias $k se resuelven al recorrer)
+    const Alphabet& alphabet = tm.getTapeAlphabet();
+    const auto& classes = tm.getSymbolClasses();
+    std::vector<SymbolPattern> reads(width);
+    std::vector<SymbolPattern> writes(width);
+    std::vector<std::vector<uint8_t>> candidates(width);
+    std::vector<std::array<int16_t, 256>> classIndex(width);   // Código leído -> posición en su clase
+    auto encodeAll = [&](const std::vector<std::string>& symbols, std::vector<uint8_t>& out) {
+        for (const std::string& symbol : symbols) {
+            try {
+                out.push_back(alphabet.encode(symbol));
+            } catch (const MTException&) {
+                // Nunca puede leerse
+            }
+        }
+    };
+    for (size_t i = 0; i < width; i++) {
+        reads[i] = SymbolPattern::parse(readSymbols[i], false, static_cast<int>(i), alphabet, classes);
+        writes[i] = SymbolPattern::parse(writeSymbols[i], true, static_cast<int>(i), alphabet, classes);
+        classIndex[i].fill(-1);
+        switch (reads[i].kind) {
+            case SymbolPattern::Kind::Exact:
+                encodeAll({reads[i].symbol}, candidates[i]);
+                break;
+            case SymbolPattern::Kind::Any:
+                encodeAll(alphabet.getSymbols(), candidates[i]);
+                break;
+            case SymbolPattern::Kind::Class:
+                if (reads[i].members == nullptr) {
+                    return;
+                }
+                for (size_t m = 0; m < reads[i].members->size(); m++) {
+                    try {
+                        classIndex[i][alphabet.encode((*reads[i].members)[m])] = static_cast<int16_t>(m);
+                    } catch (const MTException&) {
+                        continue;
+                    }
+                }
+                encodeAll(*reads[i].members, candidates[i]);
+                break;
+            case SymbolPattern::Kind::Tape:
+                if (reads[i].tape < 0 || static_cast<size_t>(reads[i].tape) >= i) {
+                    return;
+                }
+                break;
+        }
+        // Escritura: referencias a cintas existentes y clases del tamaño de la leída
+        const SymbolPattern& write = writes[i];
+        if ((write.kind == SymbolPattern::Kind::Tape &&
+             (write.tape < 0 || static_cast<size_t>(write.tape) >= width)) ||
+            (write.kind == SymbolPattern::Kind::Class &&
+             (write.members == nullptr || reads[i].kind != SymbolPattern::Kind::Class ||
+              write.members->size() != reads[i].members->size()))) {
+            return;
+        }
+    }
+
+    // Recorrido de las combinaciones: una pila de posiciones en candidates
+    std::vector<uint8_t> codes(width);
+    std::vector<uint8_t> written(width);
+    std::vector<size_t> position(width, 0);
+    size_t tape = 0;
+    while (true) {
+        if (tape == width) {
+            if (claim(state, codes.data())) {
+                bool encodable = true;
+                for (size_t i = 0; i < width && encodable; i++) {
+                    const SymbolPattern& write = writes[i];
+                    try {
+                        switch (write.kind) {
+                            case SymbolPattern::Kind::Tape:
+                                written[i] = codes[static_cast<size_t>(write.tape)];
+                                break;
+                            case SymbolPattern::Kind::Class:
+                                written[i] = alphabet.encode((*write.members)[classIndex[i][codes[i]]]);
+                                break;
+                            default:
+                                written[i] = alphabet.encode(write.symbol);
+                                break;
+                        }
+                    } catch (const MTException&) {
+                        encodable = false;
+                    }
+                }
+                if (encodable) {
+                    Entry entry = {packCodes(codes.data()), state, next, pattern.getId(),
+                                   static_cast<uint32_t>(readCodes.size()), true, -1, &pattern};
+                    for (size_t i = 0; i < width; i++) {
+                        readCodes.push_back(codes[i]);
+                        writeCodes.push_back(written[i]);
+                        moves.push_back(directions[i] == 'R' ? 1 : (directions[i] == 'L' ? -1 : 0));
+                    }
+                    entries.push_back(entry);
+                }
+            }
+            // Retroceder hasta la última cinta con candidatos pendientes
+            do {
+                if (tape == 0) {
+                    return;
+                }
+                tape--;
+            } while (reads[tape].kind == SymbolPattern::Kind::Tape || ++position[tape] >= candidates[tape].size());
+            codes[tape] = candidates[tape][position[tape]];
+            tape++;
+            continue;
+        }
+        if (reads[tape].kind == SymbolPattern::Kind::Tape) {
+            codes[tape] = codes[static_cast<size_t>(reads[tape].tape)];
+        } else {
+            if (candidates[tape].empty()) {
+                return;
+            }
+            position[tape] = 0;
+            codes[tape] = candidates[tape][0];
+        }
+        tape++;
+    }
+}
+
+int TransitionTable::findState(const std::string& name) const {
+    auto it = stateIds.find(name);
+    return it != stateIds.end() ? it->second : -1;
+}
@@ -1,30 +1,56 @@
 #include "../include/TuringMachine.h"
+#include "../include/DFAScanner.h"
+#include "../include/TransitionTable.h"
+#include "../include/MTException.h"
+#include "../include/SymbolPattern.h"
+#include "../include/TapePrimitives.h"
 #include <iostream>
+#include <algorithm>
 
 /**
  * Constructor de TuringMachine
  */
 TuringMachine::TuringMachine()
-    : initialState(State()), numberOfTapes(1), currentState(State()),
-      stepCount(0), isAccepted(false), hasHalted(false) {
-    tapes.resize(1, nullptr);
+    : initialState(State()), numberOfTapes(1), program(nullptr), currentState(State()), currentStateId(-1),
+      stepCount(0), lookupCount(0), isAccepted(false), hasHalted(false), limitExceeded(false), diverged(false),
+      divergenceCheck(false), dfa(nullptr),
+      spillResidentPages(0), tapeWindow(0), nativePrimitives(true) {
+    tapes.resize(1);
+}
+
+/**
+ * Constructor de copia: solo la definición y la configuración
+ */
+TuringMachine::TuringMachine(const TuringMachine& other)
+    : states(other.states), inputAlphabet(other.inputAlphabet), tapeAlphabet(other.tapeAlphabet),
+      initialState(other.initialState), acceptanceStates(other.acceptanceStates),
+      numberOfTapes(other.numberOfTapes), transitions(other.transitions),
+      symbolClasses(other.symbolClasses), program(nullptr),
+      currentState(other.initialState), currentStateId(-1),
+      stepCount(0), lookupCount(0), isAccepted(false), hasHalted(false), limitExceeded(false), diverged(false),
+      divergenceCheck(other.divergenceCheck), budget(other.budget.getLimits()), dfa(nullptr),
+      spillResidentPages(other.spillResidentPages), spillDirectory(other.spillDirectory),
+      tapeWindow(other.tapeWindow), nativePrimitives(other.nativePrimitives) {
+    tapes.resize(numberOfTapes);
+    if (other.dfa != nullptr) {
+        compileDFA();
+    }
 }
 
 /**
  * Destructor
  */
 TuringMachine::~TuringMachine() {
-    for (auto tape : tapes) {
-        if (tape != nullptr) {
-            delete tape;
-        }
-    }
+    // Las cintas devuelven su memoria al presupuesto: liberarlas antes que él
     tapes.clear();
+    delete dfa;
+    delete program;
 }
 
 // Métodos para construir la MT
 void TuringMachine::addState(const State& state) {
     states.insert(state);
+    invalidateProgram();
 }
 
 void TuringMachine::addInputSymbol(const std::string& symbol) {
@@ -33,17 +59,20 @@ void TuringMachine::addInputSymbol(const std::string& symbol) {
 
 void TuringMachine::addTapeSymbol(const std::string& symbol) {
     tapeAlphabet.addSymbol(symbol);
+    invalidateProgram();
 }
 
 void TuringMachine::setInitialState(const State& state) {
     initialState = state;
     initialState.setInitial(true);
     // No agregar automáticamente a states - debe estar ya definido en Q
+    invalidateProgram();
 }
 
 void TuringMachine::setBlankSymbol(const std::string& symbol) {
     tapeAlphabet.setBlankSymbol(symbol);
     tapeAlphabet.addSymbol(symbol);
+    invalidateProgram();
 }
 
 void TuringMachine::addAcceptanceState(const State& state) {
@@ -51,6 +80,7 @@ void TuringMachine::addAcceptanceState(const State& state) {
     acceptState.setAcceptance(true);
     acceptanceStates.insert(acceptState);
     // No agregar automáticamente a states - debe estar ya definido en Q
+    invalidateProgram();
 }
 
 void TuringMachine::addTransition(const Transition& transition) {
@@ -64,96 +94,306 @@ void TuringMachine::addTransition(const Transition& transition) {
     
     std::pair<std::string, std::string> key = 
         {transition.getCurrentState().getName(), symbolKey};
-    transitions[key] = transition;
+
+    // Identificador estable: una transición redefinida conserva el suyo
+    Transition stored = transition;
+    auto existing = transitions.find(key);
+    stored.setId(existing != transitions.end() ? existing->second.getId()
+                                               : static_cast<int>(transitions.size()));
+    transitions[key] = stored;
+    invalidateProgram();
+}
+
+void TuringMachine::addSymbolClass(const std::string& name, const std::vector<std::string>& symbols) {
+    symbolClasses[name] = symbols;
+    invalidateProgram();
+}
+
+const std::map<std::string, std::vector<std::string>>& TuringMachine::getSymbolClasses() const {
+    return symbolClasses;
+}
+
+bool TuringMachine::hasTransitionPatterns() const {
+    for (const auto& [key, trans] : transitions) {
+        if (SymbolPattern::isPattern(trans, tapeAlphabet)) {
+            return true;
+        }
+    }
+    return false;
 }
 
 void TuringMachine::setNumberOfTapes(int n) {
     numberOfTapes = (n < 1) ? 1 : n;
     // Limpiar cintas antiguas si existen
-    for (auto tape : tapes) {
-        if (tape != nullptr) {
-            delete tape;
-        }
+    tapes.resize(numberOfTapes);
+    invalidateProgram();
+}
+
+void TuringMachine::compileDFA() {
+    delete dfa;
+    dfa = DFAScanner::compile(*this);
+}
+
+bool TuringMachine::hasDFA() const {
+    return dfa != nullptr;
+}
+
+const TransitionTable& TuringMachine::getProgram() {
+    if (program == nullptr) {
+        program = TransitionTable::compile(*this);
     }
+    return *program;
+}
+
+void TuringMachine::setTapeSpill(size_t maxResidentPages, const std::string& directory) {
+    spillResidentPages = maxResidentPages;
+    spillDirectory = directory;
+    // Las cintas se reutilizan entre ejecuciones: recrearlas con la nueva configuración
     tapes.clear();
-    tapes.resize(numberOfTapes, nullptr);
 }
 
 // Métodos de ejecución
 void TuringMachine::initialize(const std::string& input) {
+    if (program == nullptr) {
+        program = TransitionTable::compile(*this);
+    }
     currentState = initialState;
+    currentStateId = program->getInitialState();
+    readBuffer.assign(numberOfTapes, 0);
     stepCount = 0;
+    lookupCount = 0;
     isAccepted = false;
     hasHalted = false;
+    limitExceeded = false;
+    limitReason.clear();
+    diverged = false;
+    divergence.reset(divergenceCheck);
     
-    // Limpiar cintas antiguas
-    for (auto tape : tapes) {
-        if (tape != nullptr) {
-            delete tape;
-        }
-    }
+#ifdef MT_ENABLE_PROFILER
+    profiler.reset(transitions.size());
+#endif
     
     std::string blank = tapeAlphabet.getBlankSymbol();
-    // Crear cintas
-    for (int i = 0; i < numberOfTapes; i++) {
-        if (i == 0) {
-            // La primera cinta contiene la entrada
-            tapes[i] = new Tape(input, blank, &tapeAlphabet);
-        } else {
-            // Las demás cintas empiezan vacías
-            tapes[i] = new Tape("", blank, &tapeAlphabet);
+    const std::string empty;
+    // Crear cintas, o reutilizar las de la ejecución anterior con sus páginas
+    try {
+        for (int i = 0; i < numberOfTapes; i++) {
+            // La primera cinta contiene la entrada; las demás empiezan vacías
+            const std::string& content = (i == 0) ? input : empty;
+            tapes.prepare(i, content, blank, &tapeAlphabet, &budget);
+            if (spillResidentPages > 0) {
+                tapes[i]->enableSpill(spillResidentPages, spillDirectory);
+            }
         }
+    } catch (const ResourceLimitException& e) {
+        // La entrada ya no cabe en el presupuesto
+        stopForLimit(e.what());
     }
+    // Las páginas de la ejecución anterior ya se devolvieron al reiniciar las cintas
+    budget.resetPeak();
 }
 
 bool TuringMachine::executeStep() {
     if (hasHalted) {
         return false;
     }
+
+    const long long stepLimit = budget.getLimits().maxSteps;
+    if (stepLimit > 0 && stepCount >= stepLimit) {
+        stopForLimit("pasos (" + std::to_string(stepLimit) + ")");
+        return false;
+    }
     
-    bool success = applyTransition();
+    if (currentStateId < 0) {
+        // La máquina se modificó después de initialize(): recompilar
+        if (program == nullptr) {
+            program = TransitionTable::compile(*this);
+        }
+        currentStateId = program->findState(currentState.getName());
+        readBuffer.assign(numberOfTapes, 0);
+        if (currentStateId < 0) {
+            hasHalted = true;
+            return false;
+        }
+    }
+
+    bool success;
+    try {
+        success = applyTransition();
+    } catch (const ResourceLimitException& e) {
+        stopForLimit(e.what());
+        return false;
+    }
     if (success) {
         stepCount++;
         
         // Verificar si se llegó a un estado de aceptación
-        if (acceptanceStates.find(currentState) != acceptanceStates.end()) {
+        if (program->isAccepting(currentStateId)) {
             isAccepted = true;
             hasHalted = true;
+        } else if (divergence.isActive() && divergence.observe(stepCount, currentStateId, tapes)) {
+            // La ejecución se repite para siempre: no tiene sentido seguir
+            diverged = true;
+            hasHalted = true;
         }
     }
     
     return success;
 }
 
-bool TuringMachine::execute(const std::string& input, int maxSteps) {
-    initialize(input);
-    
-    for (int i = 0; i < maxSteps && !hasHalted; i++) {
+long long TuringMachine::executeSteps(long long maxSteps) {
+#ifdef MT_ENABLE_PROFILER
+    // El perfil cuenta cada transición aplicada
+    const bool native = false;
+#else
+    // Los ciclos, el volcado y los límites de celdas y memoria se comprueban paso a paso
+    const bool native = nativePrimitives && !divergence.isActive() && spillResidentPages == 0 && budget.isUnlimited();
+#endif
+    const long long stepLimit = budget.getLimits().maxSteps;
+    long long done = 0;
+    while (done < maxSteps && !hasHalted) {
+        if (native && currentStateId >= 0) {
+            long long limit = maxSteps - done;
+            if (stepLimit > 0) {
+                limit = std::min(limit, stepLimit - stepCount);
+            }
+            const long long run = TapePrimitives::execute(*program, currentStateId, tapes, readBuffer.data(),
+                                                          primitiveBuffer, limit);
+            if (run > 0) {
+                // Un bucle sobre el mismo estado, que no es de aceptación: sigue igual que tras un paso
+                stepCount += run;
+                lookupCount += run;
+                done += run;
+                continue;
+            }
+        }
         if (!executeStep()) {
             break;
         }
+        done++;
     }
-    
+    return done;
+}
+
+bool TuringMachine::scanInput(const std::string& input, long long maxSteps) {
+    // El AFD no pasa por el crecimiento de la cinta: solo se usa si no hay
+    // límites de celdas ni de memoria que vigilar
+    const ResourceLimits& limits = budget.getLimits();
+#ifdef MT_ENABLE_PROFILER
+    // El perfil mide el motor completo: el AFD no pasa por applyTransition()
+    const bool profiling = true;
+#else
+    const bool profiling = false;
+#endif
+    if (dfa == nullptr || hasHalted || stepCount > 0 || profiling || divergenceCheck ||
+        limits.maxTapeCells != 0 || limits.maxBytes != 0) {
+        return false;
+    }
+    // Camino rápido: la máquina es un AFD, se recorre la entrada directamente
+    const bool stepLimited = limits.maxSteps > 0 && limits.maxSteps < maxSteps;
+    DFAScanner::Result result = dfa->run(input, stepLimited ? limits.maxSteps : maxSteps);
+    currentState = dfa->getState(result.finalState);
+    currentStateId = program->findState(currentState.getName());
+    stepCount = result.steps;
+    lookupCount = result.steps + (result.halted && !result.accepted ? 1 : 0);
+    isAccepted = result.accepted;
+    hasHalted = result.halted;
+    tapes[0]->load(result.cells, result.headPosition);
+    if (stepLimited && !hasHalted && stepCount == limits.maxSteps) {
+        stopForLimit("pasos (" + std::to_string(limits.maxSteps) + ")");
+    }
+    return true;
+}
+
+bool TuringMachine::execute(const std::string& input, long long maxSteps) {
+    initialize(input);
+    if (!scanInput(input, maxSteps)) {
+        executeSteps(maxSteps);
+    }
+    return isAccepted;
+}
+
+void TuringMachine::initialize(InputSource& source) {
+    initialize(std::string());
+    if (hasHalted) {
+        return;
+    }
+
+    // Sin movimientos a la izquierda en la primera cinta, lo que queda detrás del cabezal no vuelve a leerse
+    bool movesLeft = false;
+    for (const auto& [key, trans] : transitions) {
+        if (trans.getDirections()[0] == 'L') {
+            movesLeft = true;
+            break;
+        }
+    }
+    // Más allá de lo leído la cinta no es blanca: los ciclos trasladados no se pueden demostrar
+    divergence.reset(false);
+    try {
+        tapes[0]->attachInput(&source, !movesLeft);
+    } catch (const ResourceLimitException& e) {
+        stopForLimit(e.what());
+    }
+}
+
+bool TuringMachine::execute(InputSource& source, long long maxSteps) {
+    // La entrada no está disponible de antemano: sin el AFD (las primitivas no pasan de lo leído)
+    initialize(source);
+    executeSteps(maxSteps);
     return isAccepted;
 }
 
 void TuringMachine::reset() {
     currentState = initialState;
+    currentStateId = -1;
     stepCount = 0;
+    lookupCount = 0;
     isAccepted = false;
     hasHalted = false;
-    for (auto tape : tapes) {
-        if (tape != nullptr) {
-            delete tape;
-        }
-    }
+    limitExceeded = false;
+    limitReason.clear();
+    diverged = false;
+    divergence.reset(false);
     tapes.clear();
-    tapes.resize(numberOfTapes, nullptr);
 }
 
+void TuringMachine::setResourceLimits(const ResourceLimits& limits) {
+    budget.setLimits(limits);
+}
+
+const ResourceBudget& TuringMachine::getResourceBudget() const {
+    return budget;
+}
+
+void TuringMachine::setDivergenceCheck(bool enabled) {
+    divergenceCheck = enabled;
+}
+
+bool TuringMachine::hasDivergenceCheck() const {
+    return divergenceCheck;
+}
+
+void TuringMachine::setNativePrimitives(bool enabled) {
+    nativePrimitives = enabled;
+}
+
+bool TuringMachine::hasNativePrimitives() const {
+    return nativePrimitives;
+}
+
+#ifdef MT_ENABLE_PROFILER
+const ExecutionProfiler& TuringMachine::getProfiler() const {
+    return profiler;
+}
+#endif
+
 // Métodos de consulta
 const State& TuringMachine::getCurrentState() const {
-    return currentState;
+    return currentStateId >= 0 ? program->getState(currentStateId) : currentState;
+}
+
+int TuringMachine::getCurrentStateId() const {
+    return currentStateId;
 }
 
 const State& TuringMachine::getInitialState() const {
@@ -180,10 +420,14 @@ const std::map<std::pair<std::string, std::string>, Transition>& TuringMachine::
     return transitions;
 }
 
-int TuringMachine::getStepCount() const {
+long long TuringMachine::getStepCount() const {
     return stepCount;
 }
 
+long long TuringMachine::getTransitionLookups() const {
+    return lookupCount;
+}
+
 int TuringMachine::getNumberOfTapes() const {
     return numberOfTapes;
 }
@@ -200,6 +444,22 @@ bool TuringMachine::wasAccepted() const {
     return isAccepted;
 }
 
+bool TuringMachine::exceededLimits() const {
+    return limitExceeded;
+}
+
+const std::string& TuringMachine::getLimitReason() const {
+    return limitReason;
+}
+
+bool TuringMachine::hasDiverged() const {
+    return diverged;
+}
+
+const std::string& TuringMachine::getDivergenceReason() const {
+    return divergence.getReason();
+}
+
 std::string TuringMachine::getTapeContent() const {
     return getTapeContent(0);
 }
@@ -211,17 +471,46 @@ std::string TuringMachine::getTapeContent(int tapeIndex) const {
     return "";
 }
 
-int TuringMachine::getHeadPosition() const {
+long long TuringMachine::getHeadPosition() const {
     return getHeadPosition(0);
 }
 
-int TuringMachine::getHeadPosition(int tapeIndex) const {
+long long TuringMachine::getHeadPosition(int tapeIndex) const {
     if (tapeIndex >= 0 && tapeIndex < numberOfTapes && tapes[tapeIndex] != nullptr) {
         return tapes[tapeIndex]->getHeadPosition();
     }
     return -1;
 }
 
+const Tape* TuringMachine::getTape(int tapeIndex) const {
+    if (tapeIndex >= 0 && tapeIndex < numberOfTapes) {
+        return tapes[tapeIndex];
+    }
+    return nullptr;
+}
+
+std::string TuringMachine::getTapeWindow(int tapeIndex, bool markHead) const {
+    if (tapeIndex >= 0 && tapeIndex < numberOfTapes && tapes[tapeIndex] != nullptr) {
+        return tapes[tapeIndex]->getWindow(tapeWindow, markHead);
+    }
+    return "";
+}
+
+long long TuringMachine::writeTapeContent(int tapeIndex, int fd, const std::string& terminator) const {
+    if (tapeIndex >= 0 && tapeIndex < numberOfTapes && tapes[tapeIndex] != nullptr) {
+        return tapes[tapeIndex]->writeVisibleContent(fd, terminator);
+    }
+    return 0;
+}
+
+void TuringMachine::setTapeWindow(long long radius) {
+    tapeWindow = std::max(0LL, radius);
+}
+
+long long TuringMachine::getTapeWindowRadius() const {
+    return tapeWindow;
+}
+
 // Métodos de validación
 bool TuringMachine::isValidInput(const std::string& input) const {
     return inputAlphabet.isValidString(input);
@@ -233,18 +522,20 @@ bool TuringMachine::validateTransition(const std::string& state, const std::stri
 }
 
 bool TuringMachine::hasState(const std::string& stateName) const {
-    for (const auto& state : states) {
-        if (state.getName() == stateName) {
-            return true;
-        }
-    }
-    return false;
+    // Los estados se ordenan por nombre: búsqueda en el conjunto, no recorrido
+    return states.count(State(stateName)) != 0;
 }
 
 // Método para obtener información
 std::string TuringMachine::getConfiguration() const {
-    std::string config = "Estado: " + currentState.getName();
-    if (isMultiTape()) {
+    std::string config = "Estado: " + getCurrentState().getName();
+    if (tapeWindow > 0) {
+        // Solo la vecindad de cada cabezal: coste O(ventana) por paso
+        for (int i = 0; i < numberOfTapes; i++) {
+            config += isMultiTape() ? "\nCinta " + std::to_string(i + 1) + ": [" : ", Cinta: [";
+            config += getTapeWindow(i, true) + "], Cabezal: " + std::to_string(getHeadPosition(i));
+        }
+    } else if (isMultiTape()) {
         config += "\n";
         for (int i = 0; i < numberOfTapes; i++) {
             config += "Cinta " + std::to_string(i + 1) + ": [" + getTapeContent(i) + "], " +
@@ -285,42 +576,49 @@ std::string TuringMachine::toString() const {
 
 // Método privado
 bool TuringMachine::applyTransition() {
-    // Leer símbolos de todas las cintas
-    std::string symbolKey;
-    for (int i = 0; i < numberOfTapes; i++) {
-        symbolKey += tapes[i]->read();
-        if (i < numberOfTapes - 1) symbolKey += "|";
-    }
-    
-    std::pair<std::string, std::string> key = {currentState.getName(), symbolKey};
-    
+    // Leer los códigos de todas las cintas: sin cadenas ni reservas de memoria
+    tapes.readCodes(readBuffer.data());
+
     // Buscar transición
-    auto it = transitions.find(key);
-    if (it == transitions.end()) {
+    lookupCount++;
+    const TransitionTable::Entry* entry = program->find(currentStateId, readBuffer.data());
+    if (entry == nullptr) {
         // No hay transición válida
         hasHalted = true;
         return false;
     }
     
     // Aplicar transición
-    const Transition& trans = it->second;
-    const auto& writeSymbols = trans.getWriteSymbols();
-    const auto& directions = trans.getDirections();
+    MT_PROFILE_TRANSITION(profiler, entry->id);
+    const uint8_t* writeCodes = program->getWriteCodes(*entry);
+    const int8_t* moves = program->getMoves(*entry);
     
     // Escribir y mover en cada cinta
     for (int i = 0; i < numberOfTapes; i++) {
-        tapes[i]->write(writeSymbols[i]);
-        
-        char dir = directions[i];
-        if (dir == 'R') {
-            tapes[i]->moveRight();
-        } else if (dir == 'L') {
-            tapes[i]->moveLeft();
+        if (!entry->encodable) {
+            // Símbolo sin código: write() informa del error
+            tapes[i]->write(entry->source->getWriteSymbols()[i]);
         }
         // Si dir == 'S', el cabezal no se mueve
+        tapes.writeAndMove(i, writeCodes[i], moves[i]);
     }
     
-    currentState = trans.getNextState();
+    currentStateId = entry->next;
     
     return true;
 }
+
+void TuringMachine::invalidateProgram() {
+    if (currentStateId >= 0) {
+        currentState = program->getState(currentStateId);
+    }
+    delete program;
+    program = nullptr;
+    currentStateId = -1;
+}
+
+void TuringMachine::stopForLimit(const std::string& reason) {
+    limitExceeded = true;
+    limitReason = reason;
+    hasHalted = true;
+}
@@ -0,0 +1,362 @@
+#include "../include/WorkerPool.h"
+#include "../include/TuringMachine.h"
+#include "../include/MTException.h"
+#include <iostream>
+#include <thread>
+#include <algorithm>
+#include <deque>
+#include <cerrno>
+#include <cstring>
+#include <cstdint>
+
+#ifndef _WIN32
+#include <csignal>
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <sys/prctl.h>
+#endif
+
+namespace {
+
+#ifndef _WIN32
+
+bool writeAll(int fd, const std::string& data) {
+    size_t done = 0;
+    while (done < data.size()) {
+        ssize_t count = write(fd, data.data() + done, data.size() - done);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        done += static_cast<size_t>(count);
+    }
+    return true;
+}
+
+bool readAll(int fd, void* buffer, size_t size) {
+    char* out = static_cast<char*>(buffer);
+    size_t done = 0;
+    while (done < size) {
+        ssize_t count = read(fd, out + done, size - done);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            return false;
+        }
+        done += static_cast<size_t>(count);
+    }
+    return true;
+}
+
+// Mensajes: enteros de 64 bits y cadenas precedidas de su longitud
+void appendNumber(std::string& message, uint64_t value) {
+    message.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void appendString(std::string& message, const std::string& value) {
+    appendNumber(message, value.size());
+    message += value;
+}
+
+bool readNumber(int fd, uint64_t& value) {
+    return readAll(fd, &value, sizeof(value));
+}
+
+bool readString(int fd, std::string& value) {
+    uint64_t size;
+    if (!readNumber(fd, size)) {
+        return false;
+    }
+    value.resize(static_cast<size_t>(size));
+    return size == 0 || readAll(fd, &value[0], value.size());
+}
+
+void appendStrings(std::string& message, const std::vector<std::string>& values) {
+    appendNumber(message, values.size());
+    for (const std::string& value : values) {
+        appendString(message, value);
+    }
+}
+
+bool readStrings(int fd, std::vector<std::string>& values) {
+    uint64_t count;
+    if (!readNumber(fd, count)) {
+        return false;
+    }
+    values.resize(static_cast<size_t>(count));
+    for (std::string& value : values) {
+        if (!readString(fd, value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void closeFd(int& fd) {
+    if (fd >= 0) {
+        close(fd);
+        fd = -1;
+    }
+}
+
+#endif
+
+}  // namespace
+
+WorkerPool::WorkerPool(TuringMachine& tm, int processes) : machine(&tm), processCount(processes) {
+    if (processCount <= 0) {
+        processCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+}
+
+WorkerPool::~WorkerPool() {
+#ifndef _WIN32
+    for (Worker& worker : workers) {
+        retire(worker);
+    }
+#endif
+}
+
+bool WorkerPool::isSupported() {
+#ifdef _WIN32
+    return false;
+#else
+    return true;
+#endif
+}
+
+#ifdef _WIN32
+
+std::vector<PoolResult> WorkerPool::run(const std::vector<std::string>&, long long) {
+    throw MTException("Los procesos trabajadores no están disponibles en esta plataforma");
+}
+
+void WorkerPool::spawn(long long) {}
+void WorkerPool::workerMain(int, int, long long) {}
+int WorkerPool::retire(Worker&) { return 0; }
+
+#else
+
+std::vector<PoolResult> WorkerPool::run(const std::vector<std::string>& inputs, long long maxSteps) {
+    std::vector<PoolResult> results(inputs.size());
+    if (inputs.empty()) {
+        return results;
+    }
+
+    // Compilar en el coordinador: los trabajadores heredan la tabla ya construida
+    machine->initialize("");
+
+    // Un trabajador muerto cierra su tubería: el error de escritura se trata aquí
+    void (*previousHandler)(int) = std::signal(SIGPIPE, SIG_IGN);
+    std::cout.flush();
+    std::cerr.flush();
+
+    const int count = static_cast<int>(std::min(static_cast<size_t>(processCount), inputs.size()));
+    for (int i = 0; i < count; i++) {
+        spawn(maxSteps);
+    }
+
+    std::deque<size_t> queue;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        queue.push_back(i);
+    }
+    size_t finished = 0;
+    std::vector<pollfd> waiting;
+    std::vector<size_t> owners;
+    while (finished < inputs.size()) {
+        // Dar una entrada a cada trabajador libre
+        for (size_t w = 0; w < workers.size() && !queue.empty(); w++) {
+            if (workers[w].pid < 0 || workers[w].current >= 0) {
+                continue;
+            }
+            const size_t index = queue.front();
+            std::string task;
+            appendNumber(task, index);
+            appendString(task, inputs[index]);
+            if (!writeAll(workers[w].taskFd, task)) {
+                // Murió estando libre: la entrada no llegó a ejecutarse, se da a otro
+                retire(workers[w]);
+                spawn(maxSteps);
+                continue;
+            }
+            queue.pop_front();
+            workers[w].current = static_cast<long long>(index);
+        }
+
+        waiting.clear();
+        owners.clear();
+        for (size_t w = 0; w < workers.size(); w++) {
+            if (workers[w].pid >= 0 && workers[w].current >= 0) {
+                waiting.push_back(pollfd{workers[w].resultFd, POLLIN, 0});
+                owners.push_back(w);
+            }
+        }
+        if (poll(waiting.data(), waiting.size(), -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw MTException(std::string("Error al esperar a los trabajadores: ") + std::strerror(errno));
+        }
+
+        for (size_t i = 0; i < waiting.size(); i++) {
+            if (waiting[i].revents == 0) {
+                continue;
+            }
+            Worker& worker = workers[owners[i]];
+            PoolResult& result = results[static_cast<size_t>(worker.current)];
+            uint64_t index, completed, accepted, limit, steps;
+            if (readNumber(worker.resultFd, index) && readNumber(worker.resultFd, completed) &&
+                readNumber(worker.resultFd, accepted) && readNumber(worker.resultFd, limit) &&
+                readNumber(worker.resultFd, steps) && readString(worker.resultFd, result.limitReason) &&
+                readString(worker.resultFd, result.divergence) &&
+                readString(worker.resultFd, result.finalState) && readStrings(worker.resultFd, result.tapes) &&
+                readString(worker.resultFd, result.error)) {
+                result.completed = completed != 0;
+                result.accepted = accepted != 0;
+                result.limitExceeded = limit != 0;
+                result.steps = static_cast<long long>(steps);
+                worker.current = -1;
+                finished++;
+                continue;
+            }
+
+            // El trabajador murió con esta entrada: los demás siguen y se crea otro
+            const int status = retire(worker);
+            result = PoolResult();
+            if (WIFSIGNALED(status)) {
+                result.error = "el proceso trabajador terminó por la señal " + std::to_string(WTERMSIG(status));
+            } else {
+                result.error = "el proceso trabajador terminó inesperadamente";
+            }
+            finished++;
+            worker.current = -1;
+            if (!queue.empty()) {
+                spawn(maxSteps);
+            }
+        }
+    }
+
+    for (Worker& worker : workers) {
+        retire(worker);
+    }
+    workers.clear();
+    std::signal(SIGPIPE, previousHandler);
+    return results;
+}
+
+void WorkerPool::spawn(long long maxSteps) {
+    int taskPipe[2];
+    int resultPipe[2];
+    if (pipe(taskPipe) != 0) {
+        throw MTException(std::string("No se pudo crear la tubería de un trabajador: ") + std::strerror(errno));
+    }
+    if (pipe(resultPipe) != 0) {
+        close(taskPipe[0]);
+        close(taskPipe[1]);
+        throw MTException(std::string("No se pudo crear la tubería de un trabajador: ") + std::strerror(errno));
+    }
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(taskPipe[0]);
+        close(taskPipe[1]);
+        close(resultPipe[0]);
+        close(resultPipe[1]);
+        throw MTException(std::string("No se pudo crear un proceso trabajador: ") + std::strerror(errno));
+    }
+    if (pid == 0) {
+        // Solo sus propios extremos: así el cierre de un trabajador se ve como fin de archivo
+        for (Worker& other : workers) {
+            closeFd(other.taskFd);
+            closeFd(other.resultFd);
+        }
+        close(taskPipe[1]);
+        close(resultPipe[0]);
+        std::signal(SIGPIPE, SIG_DFL);
+#ifdef __linux__
+        // Si el coordinador muere, el trabajador no sigue con una entrada sin fin
+        prctl(PR_SET_PDEATHSIG, SIGKILL);
+#endif
+        workerMain(taskPipe[0], resultPipe[1], maxSteps);
+        _exit(0);  // Sin destructores ni vaciado de búferes heredados del coordinador
+    }
+
+    close(taskPipe[0]);
+    close(resultPipe[1]);
+    Worker worker;
+    worker.pid = pid;
+    worker.taskFd = taskPipe[1];
+    worker.resultFd = resultPipe[0];
+    worker.current = -1;
+
+    // Reutilizar el hueco de un trabajador retirado
+    for (Worker& slot : workers) {
+        if (slot.pid < 0) {
+            slot = worker;
+            return;
+        }
+    }
+    workers.push_back(worker);
+}
+
+void WorkerPool::workerMain(int taskFd, int resultFd, long long maxSteps) {
+    uint64_t index;
+    std::string input;
+    while (readNumber(taskFd, index) && readString(taskFd, input)) {
+        PoolResult result;
+        try {
+            machine->execute(input, maxSteps);
+            result.completed = true;
+            result.accepted = machine->wasAccepted();
+            result.limitExceeded = machine->exceededLimits();
+            result.limitReason = machine->getLimitReason();
+            result.divergence = machine->getDivergenceReason();
+            result.steps = machine->getStepCount();
+            result.finalState = machine->getCurrentState().getName();
+            for (int i = 0; i < machine->getNumberOfTapes(); i++) {
+                result.tapes.push_back(machine->getTapeContent(i));
+            }
+        } catch (const std::exception& e) {
+            result.error = e.what();
+        }
+
+        std::string message;
+        appendNumber(message, index);
+        appendNumber(message, result.completed ? 1 : 0);
+        appendNumber(message, result.accepted ? 1 : 0);
+        appendNumber(message, result.limitExceeded ? 1 : 0);
+        appendNumber(message, static_cast<uint64_t>(result.steps));
+        appendString(message, result.limitReason);
+        appendString(message, result.divergence);
+        appendString(message, result.finalState);
+        appendStrings(message, result.tapes);
+        appendString(message, result.error);
+        if (!writeAll(resultFd, message)) {
+            break;
+        }
+    }
+    close(taskFd);
+    close(resultFd);
+}
+
+int WorkerPool::retire(Worker& worker) {
+    int status = 0;
+    if (worker.pid < 0) {
+        return status;
+    }
+    closeFd(worker.taskFd);
+    closeFd(worker.resultFd);
+    while (waitpid(worker.pid, &status, 0) < 0 && errno == EINTR) {
+    }
+    worker.pid = -1;
+    return status;
+}
+
+#endif
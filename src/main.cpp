@@ -1,8 +1,110 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <limits>
+#include <fstream>
+#include <memory>
+#include <cstdio>
+#include <thread>
+#include <algorithm>
+#include <utility>
 #include "../include/MTSimulator.h"
+#include "../include/ProgressMonitor.h"
+#include "../include/InputSource.h"
+#include "../include/MachineEnumerator.h"
 #include "../include/MTException.h"
+#include "../include/TraceWriter.h"
+
+namespace {
+
+/**
+ * Modo --enumerate: busca en todas las máquinas de n estados y m símbolos
+ * argv[2] y argv[3] son n y m; el resto, opciones de la búsqueda
+ */
+int runEnumeration(int argc, char* argv[]) {
+    if (argc < 4) {
+        std::cerr << "Uso: " << argv[0] << " --enumerate <estados> <símbolos> [opciones]" << std::endl;
+        std::cerr << "  --max-steps <n>: Pasos antes de declarar una máquina indecisa (por defecto 1000)" << std::endl;
+        std::cerr << "  --threads <n>: Hilos de la búsqueda (0 = los núcleos disponibles)" << std::endl;
+        std::cerr << "  --top <k>: Máquinas que paran más tarde que se muestran (por defecto 10)" << std::endl;
+        std::cerr << "  --holders <archivo|->: Escribe cada máquina que para, una por línea (- = salida estándar)" << std::endl;
+        std::cerr << "  --save-best <archivo>: Guarda la máquina que para más tarde en formato de archivo de MT" << std::endl;
+        return 1;
+    }
+
+    EnumerationOptions options;
+    options.states = std::stoi(argv[2]);
+    options.symbols = std::stoi(argv[3]);
+    std::string holdersDestination;
+    std::string bestFile;
+    for (int i = 4; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--max-steps" && i + 1 < argc) {
+            options.maxSteps = std::stoll(argv[++i]);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            options.threads = std::stoi(argv[++i]);
+        } else if (arg == "--top" && i + 1 < argc) {
+            options.top = std::stoul(argv[++i]);
+        } else if (arg == "--holders" && i + 1 < argc) {
+            holdersDestination = argv[++i];
+        } else if (arg == "--save-best" && i + 1 < argc) {
+            bestFile = argv[++i];
+        } else {
+            std::cerr << "Error: Opción desconocida: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    MachineEnumerator enumerator(options);
+    std::ofstream holdersFile;
+    std::ostream* holdersOut = nullptr;
+    if (holdersDestination == "-") {
+        holdersOut = &std::cout;
+    } else if (!holdersDestination.empty()) {
+        holdersFile.open(holdersDestination);
+        if (!holdersFile.is_open()) {
+            std::cerr << "Error: No se pudo abrir el archivo: " << holdersDestination << std::endl;
+            return 1;
+        }
+        holdersOut = &holdersFile;
+    }
+    MachineEnumerator::HaltHandler onHalt;
+    if (holdersOut != nullptr) {
+        onHalt = [holdersOut](const EnumerationResult& result) {
+            *holdersOut << result.machine.toString() << " " << result.steps << " " << result.nonBlank << "\n";
+        };
+    }
+
+    EnumerationSummary summary = enumerator.run(onHalt);
+
+    std::cout << "\n=== Enumeración de máquinas de " << options.states << " estados y " << options.symbols
+              << " símbolos ===" << std::endl;
+    std::cout << "Máquinas: " << summary.machines << " (paran: " << summary.halted << ", ciclo: "
+              << summary.cycled << ", indecisas: " << summary.undecided << ")" << std::endl;
+    std::cout << "Tiempo: " << summary.seconds << " s";
+    if (summary.seconds > 0) {
+        std::cout << " (" << static_cast<long long>(summary.machines / summary.seconds * 60) << " máquinas/min)";
+    }
+    std::cout << std::endl;
+    std::cout << "\n=== Máquinas que paran más tarde ===" << std::endl;
+    for (const EnumerationResult& result : summary.longest) {
+        std::cout << "  " << result.machine.toString() << "  pasos: " << result.steps
+                  << ", no blancos: " << result.nonBlank << std::endl;
+    }
+
+    if (!bestFile.empty() && !summary.longest.empty()) {
+        std::ofstream best(bestFile);
+        if (!best.is_open()) {
+            std::cerr << "Error: No se pudo abrir el archivo: " << bestFile << std::endl;
+            return 1;
+        }
+        best << summary.longest.front().machine.toMachineFile();
+        std::cout << "Guardada en " << bestFile << " (ejecutar con la entrada vacía \"\")" << std::endl;
+    }
+    return 0;
+}
+
+}  // namespace
 
 /**
  * Programa principal del simulador de Máquinas de Turing
@@ -10,9 +112,42 @@
  */
 int main(int argc, char* argv[]) {
     try {
+        if (argc >= 2 && std::string(argv[1]) == "--enumerate") {
+            return runEnumeration(argc, argv);
+        }
         if (argc < 3) {
             std::cerr << "Uso: " << argv[0] << " <archivo_MT> <entrada1> [entrada2] ... [-t]" << std::endl;
             std::cerr << "  -t: Muestra la traza completa de ejecución (para todas las entradas)" << std::endl;
+            std::cerr << "  --no-trace: No guarda ni muestra la traza (ni el estado inicial y el final)" << std::endl;
+            std::cerr << "  --count-states: Muestra cuántas configuraciones ha pasado la ejecución en cada estado" << std::endl;
+            std::cerr << "  --profile: Muestra el perfil por transición, estado y movimiento (requiere MT_ENABLE_PROFILER)" << std::endl;
+            std::cerr << "  --spill-dir <dir>: Vuelca a disco las páginas frías de la cinta" << std::endl;
+            std::cerr << "  --max-resident-pages <n>: Páginas por cinta en memoria con --spill-dir (por defecto 1024)" << std::endl;
+            std::cerr << "  --max-steps <n>: Presupuesto de pasos por ejecución (sustituye al límite de 10000)" << std::endl;
+            std::cerr << "  --max-cells <n>: Máximo de celdas alcanzadas por cada cinta" << std::endl;
+            std::cerr << "  --max-memory <bytes>: Memoria de cinta por ejecución" << std::endl;
+            std::cerr << "  --global-memory <bytes>: Memoria de cinta del proceso, repartida entre ejecuciones" << std::endl;
+            std::cerr << "  --window <k>: Muestra solo k celdas a cada lado de cada cabezal en la traza" << std::endl;
+            std::cerr << "  --trace-every <k>: Imprime la traza mientras se ejecuta, una de cada k configuraciones" << std::endl;
+            std::cerr << "  --trace-format <text|csv|jsonl>: Formato de la traza (por defecto text)" << std::endl;
+            std::cerr << "  --trace-file <archivo>: Escribe la traza en un archivo en lugar de la salida estándar" << std::endl;
+            std::cerr << "  --trace-sample <n>: Conserva solo n configuraciones intermedias de la traza elegidas al azar" << std::endl;
+            std::cerr << "  --history <k>: Guarda una de cada k configuraciones como instantáneas persistentes y las imprime" << std::endl;
+            std::cerr << "  --stats <archivo|->: Escribe una línea JSON de estadísticas por ejecución (- = salida estándar)" << std::endl;
+            std::cerr << "  --progress <archivo|->: Instantáneas de progreso en JSON (- = salida de error; también con SIGUSR1)" << std::endl;
+            std::cerr << "  --progress-interval <seg>: Segundos entre instantáneas de progreso (por defecto 5)" << std::endl;
+            std::cerr << "  --input-file <archivo|->: Lee una entrada de un archivo o tubería a medida que avanza el cabezal (- = entrada estándar; se descarta un salto de línea final)" << std::endl;
+            std::cerr << "  --output <archivo|->: Escribe las cintas finales directamente desde sus páginas (- = en el resultado)" << std::endl;
+            std::cerr << "  --detect-loops: Detiene las ejecuciones que se repiten (también desplazándose por la cinta en blanco) con el resultado DIVERGE" << std::endl;
+            std::cerr << "  --no-primitives: Ejecuta paso a paso también los bucles de búsqueda, copia y comparación" << std::endl;
+            std::cerr << "  --primitives-check: Repite cada entrada paso a paso y comprueba que el resultado con primitivas nativas coincide" << std::endl;
+            std::cerr << "  --lockstep: Ejecuta las entradas en lote con el motor por lanes (solo monocinta, sin traza)" << std::endl;
+            std::cerr << "  --lockstep-check: Como --lockstep, comprobando cada resultado con el motor completo" << std::endl;
+            std::cerr << "  --jobs <n>: Ejecuta las entradas a la vez en n hilos, por porciones (0 = los núcleos disponibles)" << std::endl;
+            std::cerr << "  --slice <pasos>: Pasos por porción con --jobs (por defecto 100000)" << std::endl;
+            std::cerr << "  --policy <srf|fair>: Con --jobs, menor presupuesto y menos porciones recibidas primero (srf) o reparto equitativo (fair)" << std::endl;
+            std::cerr << "  --processes <n>: Reparte las entradas entre n procesos trabajadores (0 = los núcleos disponibles)" << std::endl;
+            std::cerr << "  " << argv[0] << " --enumerate <estados> <símbolos> [opciones]: Busca en todas las máquinas de ese tamaño" << std::endl;
             std::cerr << "Ejemplos:" << std::endl;
             std::cerr << "  " << argv[0] << " data/Ejemplo_MT.txt \"0101\" \"11\"" << std::endl;
             std::cerr << "  " << argv[0] << " data/MTproposed/mt_copiar.txt \"101\" -t" << std::endl;
@@ -22,12 +157,103 @@ int main(int argc, char* argv[]) {
         std::string mtFile = argv[1];
         std::vector<std::string> inputs;
         bool showFullTrace = false;
+        bool noTrace = false;
+        bool countStates = false;
+        bool showProfile = false;
+        std::string spillDirectory;
+        size_t maxResidentPages = 1024;
+        ResourceLimits limits;
+        long long globalMemory = 0;
+        std::string statsDestination;
+        std::string progressDestination;
+        double progressInterval = 5.0;
+        long long tapeWindow = 0;
+        long long traceStride = 0;
+        long long traceSample = 0;
+        std::string traceFormatName;
+        std::string traceDestination;
+        long long historyStride = 0;
+        std::string outputDestination;
+        std::string inputFile;
+        bool lockstep = false;
+        bool detectLoops = false;
+        int jobs = -1;
+        int processes = -1;
+        long long sliceSteps = 100000;
+        SchedulingPolicy policy = SchedulingPolicy::ShortestRemaining;
+        bool lockstepCheck = false;
+        bool nativePrimitives = true;
+        bool primitivesCheck = false;
 
         // Procesar argumentos
         for (int i = 2; i < argc; i++) {
             std::string arg = argv[i];
             if (arg == "-t") {
                 showFullTrace = true;
+            } else if (arg == "--no-trace") {
+                noTrace = true;
+            } else if (arg == "--count-states") {
+                countStates = true;
+            } else if (arg == "--profile") {
+                showProfile = true;
+            } else if (arg == "--spill-dir" && i + 1 < argc) {
+                spillDirectory = argv[++i];
+            } else if (arg == "--max-resident-pages" && i + 1 < argc) {
+                maxResidentPages = std::stoul(argv[++i]);
+            } else if (arg == "--max-steps" && i + 1 < argc) {
+                limits.maxSteps = std::stoll(argv[++i]);
+            } else if (arg == "--max-cells" && i + 1 < argc) {
+                limits.maxTapeCells = std::stoll(argv[++i]);
+            } else if (arg == "--max-memory" && i + 1 < argc) {
+                limits.maxBytes = std::stoll(argv[++i]);
+            } else if (arg == "--global-memory" && i + 1 < argc) {
+                globalMemory = std::stoll(argv[++i]);
+            } else if (arg == "--trace-every" && i + 1 < argc) {
+                traceStride = std::stoll(argv[++i]);
+            } else if (arg == "--trace-format" && i + 1 < argc) {
+                traceFormatName = argv[++i];
+            } else if (arg == "--trace-file" && i + 1 < argc) {
+                traceDestination = argv[++i];
+            } else if (arg == "--trace-sample" && i + 1 < argc) {
+                traceSample = std::stoll(argv[++i]);
+            } else if (arg == "--history" && i + 1 < argc) {
+                historyStride = std::stoll(argv[++i]);
+            } else if (arg == "--window" && i + 1 < argc) {
+                tapeWindow = std::stoll(argv[++i]);
+            } else if (arg == "--stats" && i + 1 < argc) {
+                statsDestination = argv[++i];
+            } else if (arg == "--progress" && i + 1 < argc) {
+                progressDestination = argv[++i];
+            } else if (arg == "--progress-interval" && i + 1 < argc) {
+                progressInterval = std::stod(argv[++i]);
+            } else if (arg == "--input-file" && i + 1 < argc) {
+                inputFile = argv[++i];
+            } else if (arg == "--output" && i + 1 < argc) {
+                outputDestination = argv[++i];
+            } else if (arg == "--jobs" && i + 1 < argc) {
+                jobs = std::stoi(argv[++i]);
+            } else if (arg == "--processes" && i + 1 < argc) {
+                processes = std::stoi(argv[++i]);
+            } else if (arg == "--slice" && i + 1 < argc) {
+                sliceSteps = std::stoll(argv[++i]);
+            } else if (arg == "--policy" && i + 1 < argc) {
+                std::string name = argv[++i];
+                if (name != "srf" && name != "fair") {
+                    std::cerr << "Error: Política desconocida: " << name << " (srf o fair)" << std::endl;
+                    return 1;
+                }
+                policy = name == "fair" ? SchedulingPolicy::FairShare : SchedulingPolicy::ShortestRemaining;
+            } else if (arg == "--detect-loops") {
+                detectLoops = true;
+            } else if (arg == "--no-primitives") {
+                nativePrimitives = false;
+            } else if (arg == "--primitives-check") {
+                primitivesCheck = true;
+            } else if (arg == "--lockstep") {
+                lockstep = true;
+            } else if (arg == "--lockstep-check") {
+                lockstep = true;
+                lockstepCheck = true;
             } else {
                 // Si no es un flag, es una cadena de entrada
                 inputs.push_back(arg);
@@ -35,6 +261,114 @@ int main(int argc, char* argv[]) {
         }
 
         MTSimulator simulator;
+        if (!spillDirectory.empty()) {
+            simulator.setTapeSpill(maxResidentPages, spillDirectory);
+        }
+
+        simulator.setTapeWindow(tapeWindow);
+        simulator.setDivergenceCheck(detectLoops);
+        simulator.setNativePrimitives(nativePrimitives);
+
+        std::unique_ptr<ProgressMonitor> progress;
+        if (!progressDestination.empty()) {
+            progress.reset(new ProgressMonitor(progressDestination, progressInterval));
+            simulator.setProgressMonitor(progress.get());
+        }
+
+        std::unique_ptr<std::FILE, int (*)(std::FILE*)> outputFile(nullptr, std::fclose);
+        if (outputDestination == "-") {
+            simulator.setTapeOutput(1, "la salida estándar");
+        } else if (!outputDestination.empty()) {
+            outputFile.reset(std::fopen(outputDestination.c_str(), "wb"));
+            if (!outputFile) {
+                std::cerr << "Error: No se pudo abrir el archivo de salida: " << outputDestination << std::endl;
+                return 1;
+            }
+            simulator.setTapeOutput(fileno(outputFile.get()), outputDestination);
+        }
+
+        // La traza se escribe durante la ejecución (nunca se guarda entera en memoria)
+        const bool streamTrace = showFullTrace || traceStride > 0 || traceSample > 0 || !traceFormatName.empty() ||
+                                 !traceDestination.empty();
+        TraceFormat traceFormat = TraceFormat::Text;
+        if (!traceFormatName.empty() && !TraceWriter::parseFormat(traceFormatName, traceFormat)) {
+            std::cerr << "Error: Formato de traza desconocido: " << traceFormatName << " (text, csv o jsonl)" << std::endl;
+            return 1;
+        }
+        std::unique_ptr<std::FILE, int (*)(std::FILE*)> traceFile(nullptr, std::fclose);
+        if (!traceDestination.empty()) {
+            traceFile.reset(std::fopen(traceDestination.c_str(), "wb"));
+            if (!traceFile) {
+                std::cerr << "Error: No se pudo abrir el archivo de traza: " << traceDestination << std::endl;
+                return 1;
+            }
+        }
+        std::unique_ptr<TraceWriter> traceWriter;
+        if (streamTrace) {
+            traceWriter.reset(new TraceWriter(traceFile ? fileno(traceFile.get()) : 1, traceFormat));
+            traceWriter->setStride(traceStride);
+            traceWriter->setSampleSize(static_cast<size_t>(std::max(traceSample, 0LL)));
+            simulator.setTraceWriter(traceWriter.get());
+        }
+        // Sin -t solo se muestran el estado inicial y el final: no se formatea ningún paso intermedio
+        simulator.setTracePolicy(noTrace ? TracePolicy::None : TracePolicy::Summary);
+        simulator.setStateCounting(countStates);
+
+        std::ofstream statsFile;
+        std::ostream* statsOut = nullptr;
+        if (statsDestination == "-") {
+            statsOut = &std::cout;
+        } else if (!statsDestination.empty()) {
+            statsFile.open(statsDestination);
+            if (!statsFile.is_open()) {
+                std::cerr << "Error: No se pudo abrir el archivo de estadísticas: " << statsDestination << std::endl;
+                return 1;
+            }
+            statsOut = &statsFile;
+        }
+
+        // Opciones que miran cada ejecución desde este proceso: obligan a ejecutar las entradas de una en una
+        std::vector<std::string> perRunOptions;
+        const std::pair<bool, const char*> perRunFlags[] = {
+            {showFullTrace, "-t"}, {traceStride > 0, "--trace-every"}, {traceSample > 0, "--trace-sample"},
+            {!traceFormatName.empty(), "--trace-format"}, {!traceDestination.empty(), "--trace-file"},
+            {showProfile, "--profile"}, {statsOut != nullptr, "--stats"}, {progress != nullptr, "--progress"},
+            {!outputDestination.empty(), "--output"}, {historyStride > 0, "--history"},
+            {countStates, "--count-states"}, {primitivesCheck, "--primitives-check"}};
+        for (const auto& flag : perRunFlags) {
+            if (flag.first) {
+                perRunOptions.push_back(flag.second);
+            }
+        }
+        auto warnIgnored = [](const std::string& option, const std::vector<std::string>& conflicts,
+                              const std::string& fallback) {
+            std::cerr << "Advertencia: se ignora " << option << " con";
+            for (size_t i = 0; i < conflicts.size(); i++) {
+                std::cerr << (i > 0 ? ", " : " ") << conflicts[i];
+            }
+            std::cerr << " (" << fallback << ")" << std::endl;
+        };
+
+        // Las entradas se ejecutan de una en una (toda la memoria global es para cada ejecución)
+        // salvo con --jobs, que reparte la memoria global entre los hilos
+        const bool plainBatch = !inputs.empty() && perRunOptions.empty();
+        if (!inputs.empty() && !plainBatch && processes >= 0) {
+            warnIgnored("--processes", perRunOptions, "las entradas se ejecutan de una en una");
+        }
+        if (!inputs.empty() && !plainBatch && jobs >= 0) {
+            warnIgnored("--jobs", perRunOptions, "las entradas se ejecutan de una en una");
+        }
+        const bool multiProcess = plainBatch && processes >= 0;
+        const bool scheduled = plainBatch && !multiProcess && jobs >= 0;
+        const int workers = multiProcess ? processes : jobs;
+        int concurrentRuns = 1;
+        if (multiProcess || scheduled) {
+            concurrentRuns = workers > 0 ? workers : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        }
+        ResourceGovernor::process().setMaxBytes(globalMemory);
+        simulator.setResourceLimits(ResourceGovernor::process().share(limits, concurrentRuns));
+        // Con presupuesto de pasos explícito, es el presupuesto quien detiene la ejecución
+        const long long maxSteps = limits.maxSteps > 0 ? std::numeric_limits<long long>::max() : 10000;
 
         // Cargar la máquina de Turing (detecta automáticamente mono/multicinta)
         if (!simulator.loadMachine(mtFile)) {
@@ -45,21 +379,82 @@ int main(int argc, char* argv[]) {
         std::cout << "Máquina de Turing cargada exitosamente." << std::endl;
         simulator.printMachineInfo();
 
+        // El motor por lanes no genera traza, perfil ni estadísticas por ejecución
+        std::vector<std::string> lockstepConflicts = perRunOptions;
+        if (!inputFile.empty()) {
+            lockstepConflicts.push_back("--input-file");
+        }
+        if (detectLoops) {
+            lockstepConflicts.push_back("--detect-loops");
+        }
+        const bool batch = lockstep && lockstepConflicts.empty();
+        if (lockstep && !inputs.empty() && !batch) {
+            warnIgnored(lockstepCheck ? "--lockstep-check" : "--lockstep", lockstepConflicts, "se usa el motor normal");
+        }
+        if (batch && !inputs.empty()) {
+            if (simulator.runLockstep(inputs, maxSteps, lockstepCheck)) {
+                return 0;
+            }
+            std::cerr << "Advertencia: se ignora " << (lockstepCheck ? "--lockstep-check" : "--lockstep")
+                      << ": el motor por lanes no admite esta máquina o estos límites (solo monocinta,"
+                      << " sin --max-cells ni --max-memory; se usa el motor normal)" << std::endl;
+        }
+        if (multiProcess && simulator.runProcesses(inputs, maxSteps, concurrentRuns)) {
+            inputs.clear();
+            if (inputFile.empty()) {
+                return 0;
+            }
+        }
+        if (scheduled || (multiProcess && !inputs.empty())) {
+            // Sin procesos trabajadores en esta plataforma: hilos en su lugar
+            simulator.runScheduled(inputs, maxSteps, concurrentRuns, sliceSteps, policy);
+            inputs.clear();
+            if (inputFile.empty()) {
+                return 0;
+            }
+        }
+
+        auto report = [&](bool tracePrinted, const std::string* input) {
+            if (!tracePrinted && !noTrace) {
+                // Sin traza durante la ejecución: solo el estado inicial y el final
+                simulator.printSummaryTrace();
+            }
+            simulator.printResult();
+            if (countStates) {
+                simulator.printStateCounts();
+            }
+            if (showProfile) {
+                simulator.printProfile();
+            }
+            if (input != nullptr && primitivesCheck) {
+                simulator.checkPrimitives(*input, maxSteps);
+            }
+            if (input != nullptr && historyStride > 0) {
+                simulator.printHistory(*input, maxSteps, historyStride);
+            }
+            if (statsOut != nullptr) {
+                *statsOut << simulator.getLastStats().toJson() << std::endl;
+            }
+            std::cout << "=================================================\n" << std::endl;
+        };
+
         // Ejecutar con las entradas
-        if (!inputs.empty()) {
+        if (!inputs.empty() || !inputFile.empty()) {
             for (const std::string& input : inputs) {
                 std::cout << "\n=================================================" << std::endl;
                 std::cout << "Ejecutando con entrada: \"" << input << "\"" << std::endl;
                 
-                simulator.run(input); 
-                
-                if (showFullTrace) {
-                    simulator.printExecutionTrace();
-                } else {
-                    simulator.printSummaryTrace();
-                }               
-                simulator.printResult();
-                std::cout << "=================================================\n" << std::endl;
+                simulator.run(input, maxSteps);
+                report(streamTrace, &input);
+            }
+            if (!inputFile.empty()) {
+                // La entrada se lee mientras se ejecuta (la traza se escribe igual que con las demás entradas)
+                InputSource source(inputFile);
+                std::cout << "\n=================================================" << std::endl;
+                std::cout << "Ejecutando con entrada de: " << (inputFile == "-" ? "entrada estándar" : inputFile) << std::endl;
+
+                simulator.run(source, maxSteps);
+                report(streamTrace, nullptr);
             }
         } else {
             std::cout << "No se proporcionó ninguna cadena de entrada." << std::endl;
@@ -0,0 +1,252 @@
+#include "../include/MTParser.h"
+#include "../include/TuringMachine.h"
+#include "../include/MTException.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+/**
+ * Prueba de regresión: el bucle de pasos no reserva memoria
+ *
+ * Sustituye el operator new global, también sus formas alineadas y sin
+ * excepciones, y ejecuta cerca de un millón de pasos con cada máquina de
+ * data/. La primera ejecución de cada máquina crea las páginas de las cintas;
+ * en las siguientes initialize() las reutiliza y durante executeSteps() no
+ * debe haber ninguna reserva, ni paso a paso ni con las primitivas nativas.
+ */
+
+namespace {
+
+std::atomic<bool> counting(false);
+std::atomic<long long> allocations(0);
+
+void* allocate(std::size_t size) {
+    if (counting.load(std::memory_order_relaxed)) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    void* p = std::malloc(size > 0 ? size : 1);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+/**
+ * Para las clases sobrealineadas (TapeCursor es alignas(64))
+ */
+void* allocateAligned(std::size_t size, std::align_val_t alignment) {
+    if (counting.load(std::memory_order_relaxed)) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    const std::size_t align = std::max(static_cast<std::size_t>(alignment), sizeof(void*));
+#ifdef _WIN32
+    void* p = _aligned_malloc(size > 0 ? size : 1, align);
+#else
+    void* p = nullptr;
+    if (posix_memalign(&p, align, size > 0 ? size : 1) != 0) {
+        p = nullptr;
+    }
+#endif
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void releaseAligned(void* p) {
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+const long long STEPS = 1000000;
+
+/**
+ * Máquina de data/ y una entrada con la que da muchos pasos
+ */
+struct Case {
+    std::string file;
+    std::string input;
+};
+
+std::string repeat(const std::string& unit, size_t times) {
+    std::string result;
+    for (size_t i = 0; i < times; i++) {
+        result += unit;
+    }
+    return result;
+}
+
+/**
+ * Ejecuta la máquina hasta sumar STEPS pasos
+ * @return Reservas durante executeSteps() (-1 si la máquina no avanza)
+ */
+long long countAllocations(TuringMachine& tm, const std::string& input) {
+    // Calentamiento: páginas de las cintas y tabla compilada
+    tm.initialize(input);
+    tm.executeSteps(STEPS);
+
+    long long steps = 0;
+    long long found = 0;
+    while (steps < STEPS) {
+        tm.initialize(input);
+        allocations = 0;
+        counting = true;
+        const long long taken = tm.executeSteps(STEPS - steps);
+        counting = false;
+        found += allocations;
+        if (taken == 0) {
+            return -1;
+        }
+        steps += taken;
+    }
+    return found;
+}
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return allocate(size);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocate(size);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocate(size);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept {
+    std::free(p);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return allocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return allocateAligned(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    try {
+        return allocateAligned(size, alignment);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    try {
+        return allocateAligned(size, alignment);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    releaseAligned(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept {
+    releaseAligned(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+    releaseAligned(p);
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept {
+    releaseAligned(p);
+}
+
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+    releaseAligned(p);
+}
+
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+    releaseAligned(p);
+}
+
+int main(int argc, char* argv[]) {
+    const std::string data = argc > 1 ? argv[1] : "data";
+    const std::vector<Case> cases = {
+        {"Ejemplo_MT.txt", repeat("01", 1 << 16)},
+        {"Ejemplo2_MT.txt", repeat("1", 300)},
+        {"MTproposed/mt_abcontador.txt", repeat("a", 300) + repeat("b", 400)},
+        {"MTproposed/mt_an_bm.txt", repeat("a", 300) + repeat("b", 400)},
+        {"multitape/mt_copiar.txt", repeat("01", 1 << 16)},
+        {"multitape/mt_copiar_patrones.txt", repeat("01", 1 << 16)},
+    };
+
+    int failures = 0;
+    for (const Case& test : cases) {
+        const std::string path = data + "/" + test.file;
+        std::unique_ptr<TuringMachine> tm;
+        try {
+            tm.reset(MTParser::parseFile(path));
+        } catch (const MTException& e) {
+            std::cerr << path << ": " << e.what() << std::endl;
+            failures++;
+            continue;
+        }
+        for (bool native : {false, true}) {
+            tm->setNativePrimitives(native);
+            const long long found = countAllocations(*tm, test.input);
+            const std::string mode = native ? "con primitivas" : "paso a paso";
+            if (found != 0) {
+                std::cerr << path << " (" << mode << "): "
+                          << (found < 0 ? "la máquina no avanza" : std::to_string(found) + " reservas")
+                          << std::endl;
+                failures++;
+            } else {
+                std::cout << path << " (" << mode << "): OK" << std::endl;
+            }
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+#include "../include/MTParser.h"
+#include "../include/TuringMachine.h"
+#include "../include/MTException.h"
+#include "../include/InputSource.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Prueba de regresión: cintas volcadas a disco con una sola página residente
+ *
+ * Ejecuta varias entradas seguidas, cada una de varias páginas, con la misma
+ * máquina y un límite de una página en memoria. La página que se crea al cargar
+ * la entrada no puede volcarse antes de escribirla, y el resultado debe ser
+ * el mismo que sin volcado. Cada entrada se ejecuta también leída bajo demanda
+ * desde un archivo (--input-file).
+ */
+
+namespace {
+
+const long long MAX_STEPS = 1000000;
+
+/**
+ * Máquina de data/ y las entradas que se ejecutan una tras otra
+ */
+struct Case {
+    std::string file;
+    std::vector<std::string> inputs;
+};
+
+std::string repeat(const std::string& unit, size_t times) {
+    std::string result;
+    for (size_t i = 0; i < times; i++) {
+        result += unit;
+    }
+    return result;
+}
+
+/**
+ * Veredicto, pasos y cintas de una ejecución
+ */
+std::string describe(const TuringMachine& tm) {
+    std::string result = tm.wasAccepted() ? "ACEPTA" : "RECHAZA";
+    result += " " + std::to_string(tm.getStepCount());
+    for (int i = 0; i < tm.getNumberOfTapes(); i++) {
+        result += " [" + tm.getTapeContent(i) + "]@" + std::to_string(tm.getHeadPosition(i));
+    }
+    return result;
+}
+
+/**
+ * Ejecuta la entrada leyéndola bajo demanda desde un archivo temporal
+ */
+void executeStreamed(TuringMachine& tm, const std::string& input, const std::string& path) {
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << input;
+    }
+    InputSource source(path);
+    tm.execute(source, MAX_STEPS);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const std::string data = argc > 1 ? argv[1] : "data";
+    const std::string spillDirectory = argc > 2 ? argv[2] : ".";
+    const std::string inputPath = spillDirectory + "/SpillTest.input";
+    const std::vector<Case> cases = {
+        {"Ejemplo_MT.txt", {repeat("0", 10000), repeat("0", 10000), repeat("01", 9000)}},
+        {"MTproposed/mt_an_bm.txt", {repeat("a", 50) + repeat("b", 9000), repeat("a", 50) + repeat("b", 9000)}},
+        {"multitape/mt_copiar.txt", {repeat("01", 5000), repeat("10", 6000)}},
+    };
+
+    int failures = 0;
+    for (const Case& test : cases) {
+        const std::string path = data + "/" + test.file;
+        std::unique_ptr<TuringMachine> reference;
+        std::unique_ptr<TuringMachine> spilled;
+        try {
+            reference.reset(MTParser::parseFile(path));
+            spilled.reset(MTParser::parseFile(path));
+            spilled->setTapeSpill(1, spillDirectory);
+        } catch (const MTException& e) {
+            std::cerr << path << ": " << e.what() << std::endl;
+            failures++;
+            continue;
+        }
+        for (size_t i = 0; i < test.inputs.size(); i++) {
+            for (bool streamed : {false, true}) {
+                const std::string label = path + " (entrada " + std::to_string(i + 1)
+                                          + (streamed ? ", bajo demanda" : "") + ")";
+                try {
+                    if (streamed) {
+                        executeStreamed(*reference, test.inputs[i], inputPath);
+                        executeStreamed(*spilled, test.inputs[i], inputPath);
+                    } else {
+                        reference->execute(test.inputs[i], MAX_STEPS);
+                        spilled->execute(test.inputs[i], MAX_STEPS);
+                    }
+                } catch (const MTException& e) {
+                    std::cerr << label << ": " << e.what() << std::endl;
+                    failures++;
+                    continue;
+                }
+                const std::string expected = describe(*reference);
+                const std::string found = describe(*spilled);
+                if (found != expected) {
+                    std::cerr << label << ": con volcado " << found.substr(0, 80)
+                              << "..., sin volcado " << expected.substr(0, 80) << "..." << std::endl;
+                    failures++;
+                } else {
+                    std::cout << label << ": OK" << std::endl;
+                }
+            }
+        }
+    }
+    std::remove(inputPath.c_str());
+    return failures == 0 ? 0 : 1;
+}